@@ -29,6 +29,8 @@
 #include "tq.h"
 #include "videogen.h"
 #include "tiles.h"
+#include "font.h"
+#include "text.h"
 #include "room.h"
 #include "gamepad.h"
 #include "player.h"
@@ -36,30 +38,59 @@
 #include "audio.h"
 #include "sfx.h"
 #include "playroutine.h"
+#include "profile.h"
+#include "trace.h"
 
 extern void intro();
 
+// frame timing diagnostics
+uint16_t overrunFrames;		// frames that started before the game loop was ready for them
+uint16_t skippedTicks;		// game ticks dropped after a long overrun
+
+static bool roomUpdateDeferred;	// the last tick changed rooms before its tiles and enemies were updated
+
 void newgame() {
-	setVideoMode(VIDMODE_TILES_AND_SPRITES);
 	clearRoomState();
 	initRoom(0);
 	initPlayer();
 }
 
+#ifdef DEBUG_TILES
+// every tile in VIDMODE_WIDE with a sprite walking back and forth on each hardware sprite, never returns
+void showTileSheet() {
+	static PROGMEM const uint8_t walkers[NUM_SPRITES] = { TILE_WYVERN, TILE_GHOST_RIGHT, TILE_PLAYER_RIGHT };
+
+	for(uint8_t i = 0; i < WIDE_TILES_X*WIDE_TILES_Y; i++)
+		setTile(i, i < sizeof(tiles) / 64 ? i : TILE_EMPTY);
+	setVideoMode(VIDMODE_WIDE);
+
+	for(uint8_t t = 0; ; t++) {
+		waitForVBlank();
+		clearSprites();
+		for(uint8_t sp = 0; sp < NUM_SPRITES; sp++) {
+			uint8_t x = (t + sp*32) % (2*(SCREEN_WIDTH - 8));
+			if(x >= SCREEN_WIDTH - 8)
+				x = 2*(SCREEN_WIDTH - 8) - x;
+			updateSprite(sp, pgm_read_byte_near(&walkers[sp]), x, 8 + sp*16);
+		}
+		presentSprites();
+	}
+}
+#endif
+
 void setup() {
 	initAudio();
 	initPlayroutine();
 	clearSprites();
 	initScreen();
 	initController();
+#ifdef DEBUG_TILES
+	showTileSheet();
+#endif
 #ifdef SHOW_TITLESCREEN
 	intro();
 #endif
 	newgame();
-
-	// debug tiles
-	//for(int i = 0; i < NUM_TILES_X*NUM_TILES_Y; i++)
-	//	tmap[i] = &tiles[i * 64];
 }
 
 void updateTiles() {
@@ -98,78 +129,143 @@ void updateTiles() {
 	}
 }
 
-void updateAudio() {
-	// mix audio for next frame to be displayed
-	// audio buffers will be swapped at the last scanline by vid gen timer interrupt
-	mixAudio(audioBufferWritePtr, 263);
-
+// music and sound effects advance once per frame
+void updateMusic() {
 #ifdef ENABLE_MUSIC
+	PROFILE_BEGIN();
+	TRACE_BEGIN(TRACE_MUSIC);
 	updateSounds();
 	updatePlayroutine();
 	updateEffects();
 	updateEnvelopes();
+	TRACE_END(TRACE_MUSIC);
+	PROFILE_END(PROFILE_MUSIC);
 #endif
 }
 
-void loop() {
-	while(true) {
-#ifdef DEBUG_SCANLINES
-		int start = scanLine;
-#endif
+void updateAudio() {
+	// mix audio for next frame to be displayed
+	// audio buffers will be swapped at the last scanline by vid gen timer interrupt
+	PROFILE_BEGIN();
+	TRACE_BEGIN(TRACE_MIX);
+	mixAudio(audioBufferWritePtr, 263);
+	TRACE_END(TRACE_MIX);
+	PROFILE_END(PROFILE_MIX);
+	updateMusic();
+}
 
-		updateController();	// 3 scanlines
-
-		if(!p.gameover) {
-			clearSprites();	// 2 scanlines
-			updatePlayer();	// 2 scanlines
-			updateTiles();	// 1 scanlines
-			updateEnemies();
-		} else {
-			// game over
-
-			// clear sprites that are on top of game over text
-			for(uint8_t y = 5*8; y < 6*8; y++) {
-				for(uint8_t sp = 0; sp < NUM_SPRITES; sp++) {
-					volatile SpriteLine* buf = &spriteBuffer[y * NUM_SPRITES + sp];
-					if(buf->x >= 2*8 && buf->x < 11*8) {
-						buf->img = tiles;
-						buf->x = 0;
-					}
-				}
-			}
+// tile animation and enemy movement of one tick, the room must be in tmap
+void updateRoom() {
+	TRACE_BEGIN(TRACE_TILES);
+	updateTiles();	// 1 scanlines
+	TRACE_END(TRACE_TILES);
+	PROFILE_END(PROFILE_TILES);
+	TRACE_BEGIN(TRACE_ENEMIES);
+	updateEnemies();
+	TRACE_END(TRACE_ENEMIES);
+	PROFILE_END(PROFILE_ENEMIES);
+}
 
-			// score bonus from remaining time
-			if(p.gameover == 2) {
-				if(p.time >= 256) {
-					playSound(SOUND_GOLD);
-					p.score += 25;					
-					p.time -= 256;
-				} else {
-					p.time = 0;
-				}
-			}
+// one game tick, run every FRAMES_PER_TICK frames
+void updateGame() {
+	TRACE_BEGIN(TRACE_TICK);
+	PROFILE_BEGIN();
+
+	// a tick that changes rooms leaves its tile and enemy update until the new room has been committed to
+	// tmap, it is done here before the next controller read so that no update is lost. The sprites of that
+	// one tick go without the enemies.
+	if(roomUpdateDeferred) {
+		TRACE_BEGIN(TRACE_COMMIT_WAIT);
+		while(isRoomCommitPending());
+		TRACE_END(TRACE_COMMIT_WAIT);
+		PROFILE_END(PROFILE_COMMIT);
+		updateRoom();
+		roomUpdateDeferred = false;
+	}
 
-			if(controllerState & BUTTON_START) {
-				intro();
-				newgame();
+	TRACE_BEGIN(TRACE_CONTROLLER);
+	updateController();	// 3 scanlines
+	TRACE_END(TRACE_CONTROLLER);
+	PROFILE_END(PROFILE_CONTROLLER);
+
+	if(!p.gameover) {
+		// a room set up by newgame must be in tmap before collisions are checked against it
+		TRACE_BEGIN(TRACE_COMMIT_WAIT);
+		while(isRoomCommitPending());
+		TRACE_END(TRACE_COMMIT_WAIT);
+		PROFILE_END(PROFILE_COMMIT);
+
+		clearSprites();
+		PROFILE_END(PROFILE_SPRITES);
+		TRACE_BEGIN(TRACE_PLAYER);
+		updatePlayer();	// 2 scanlines
+		TRACE_END(TRACE_PLAYER);
+		PROFILE_END(PROFILE_PLAYER);
+
+		if(isRoomCommitPending())
+			roomUpdateDeferred = true;
+		else
+			updateRoom();
+		presentSprites();
+		PROFILE_END(PROFILE_SPRITES);
+	} else {
+		// game over
+
+		// score bonus from remaining time
+		if(p.gameover == 2) {
+			if(p.time >= 256) {
+				playSound(SOUND_GOLD);
+				p.score += 25;					
+				p.time -= 256;
+			} else {
+				p.time = 0;
 			}
 		}
 
-		updateScoreBar();
-		updateAudio();
+		if(controllerState & BUTTON_START) {
+			intro();
+			newgame();
+		}
+	}
 
-#ifdef DEBUG_SCANLINES
-		// how many scanlines was spent updating the game
-		// NTSC vblank is 46 scanlines
-		int lines = scanLine - start;
-		p.updateScanlines = lines;
-		//p.updateScanlines = p.room;
-#endif
+	PROFILE_BEGIN();
+	TRACE_BEGIN(TRACE_HUD);
+	updateScoreBar();
+	TRACE_END(TRACE_HUD);
+	PROFILE_END(PROFILE_HUD);
+	PROFILE_END_TICK();
+	TRACE_END(TRACE_TICK);
+}
 
-		waitForVBlank();
+void loop() {
+	uint8_t tickFrames = 0;	// frames since the last game tick
+
+	while(true) {
+		uint8_t frames = waitForVBlank();
 
+		// one audio buffer is mixed per frame right after the swap, so a long tick cannot put mixing out of
+		// phase with the swaps. Buffers of missed frames were played twice but the music keeps its tempo.
+		for(uint8_t i = 1; i < frames; i++)
+			updateMusic();
 		updateAudio();
 
-		waitForVBlank();
+		if(frames > 1)
+			overrunFrames += frames - 1;
+
+		tickFrames += frames;
+		if(tickFrames < FRAMES_PER_TICK)
+			continue;
+		tickFrames -= FRAMES_PER_TICK;
+
+		// catch up one missed tick right away, skip the rest so that a slow stretch cannot snowball
+		if(tickFrames >= FRAMES_PER_TICK) {
+			tickFrames -= FRAMES_PER_TICK;
+			if(tickFrames >= FRAMES_PER_TICK) {
+				skippedTicks += tickFrames / FRAMES_PER_TICK;
+				tickFrames %= FRAMES_PER_TICK;
+			}
+			updateGame();
+		}
+		updateGame();
 	}
 }
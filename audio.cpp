@@ -26,8 +26,8 @@
 
 Oscillator osc[OSCILLATORS];
 volatile uint8_t audioBuffer[263*2];
-extern volatile uint8_t* audioBufferWritePtr = audioBuffer;
-extern volatile uint8_t* audioBufferReadPtr = audioBuffer + 263;
+volatile uint8_t* audioBufferWritePtr = audioBuffer;
+volatile uint8_t* audioBufferReadPtr = audioBuffer + 263;
 
 uint16_t noise = 0xACE1;
 int envelopeUpdateCounter = 0;
@@ -94,7 +94,7 @@ void initAudio()
 	*/
 }
 
-#if 1
+#ifdef __AVR__
 void mixAudio(volatile uint8_t* buf, int numSamples)
 {
 	__asm__ __volatile__ (
@@ -304,15 +304,16 @@ void mixAudio(volatile uint8_t* buf, int numSamples)
 	);
 
 }
-#endif
-
-#if 0
+#else
+// C version of the mixer above for host builds, produces the same samples bit for bit:
+// all four channels are mixed, pulse and triangle compare with the sign of phase - x like brmi/brpl do,
+// sawtooth falls, and the noise LFSR is kept byte swapped in noise and stepped on every sample
 void mixAudio(volatile uint8_t* buf, int numSamples)
 {
 	for(int s = 0; s < numSamples; s++) {
-		int16_t output = 0;
+		uint16_t output = 0;
 
-		for(uint8_t i=0; i<OSCILLATORS; i++)
+		for(uint8_t i=0; i<4; i++)
 		{
 			// update oscillator phase
 			osc[i].phase += osc[i].frequency;
@@ -320,56 +321,45 @@ void mixAudio(volatile uint8_t* buf, int numSamples)
 
 			int8_t value = 0;  // [-64,63]
 
-			switch(osc[i].waveform)
+			switch(osc[i].waveform & 3)
 			{
-			case TRIANGLE: 
-				if(phase < 128)
+			case TRIANGLE:
+				if((int8_t)(phase - 128) < 0)
 					value = phase - 64;
 				else
 					value = (255 - phase) - 63;
 				break;
 
 			case PULSE:
-				value = (phase < osc[i].pulseWidth ? -64 : 63);
+				value = ((int8_t)(phase - osc[i].pulseWidth) < 0 ? -64 : 63);
 				break;
 
 			case SAWTOOTH:
-				value = (phase>>1) - 64;
+				value = (int8_t)(128 - phase) >> 1;
 				break;
 
 			case NOISE:
-				if(phase > 64)
 				{
 					// Galois LFSR, see http://en.wikipedia.org/wiki/Linear_feedback_shift_register
-					noise = (noise >> 1) ^ (-(noise & 1) & 0xB400u);
-
-					osc[i].noise = (int)(noise >> 9) - 64;
-					osc[i].phase -= 16384;
+					uint16_t lfsr = (noise << 8) | (noise >> 8);
+					lfsr = (lfsr >> 1) ^ (-(lfsr & 1) & 0xB400u);
+					noise = (lfsr << 8) | (lfsr >> 8);
+
+					if((int8_t)(phase - 64) < 0)
+					{
+						osc[i].noise = (int8_t)((lfsr >> 9) - 64);
+						osc[i].phase -= 16384;
+					}
+					value = osc[i].noise;
 				}
-				value = osc[i].noise;
 				break;
 			}
-			   
-			int16_t amp = osc[i].amp>>8;  // [0,127]
-			output += value * amp;  // [-8192,8191]
+
+			uint8_t amp = osc[i].amp>>8;  // [0,127]
+			output += (uint16_t)(value * amp);  // [-8192,8191]
 		}
 
-		// update envelopes every 16th cycle
-		// if(envelopeUpdateCounter == 0)
-		// {
-		// 	updateEnvelopes();
-		//  	envelopeUpdateCounter = 16;
-		// }
-		// envelopeUpdateCounter--;
-	 
-#if OSCILLATORS == 4
-		uint8_t sample = (output>>8) + 128;
-#elif OSCILLATORS == 2
-		uint8_t sample = (output>>7) + 128;
-#elif OSCILLATORS == 1
-		uint8_t sample = (output>>6) + 128;
-#endif
-		*buf++ = sample;
+		*buf++ = (output>>8) + 128;
 	}
 }
 #endif
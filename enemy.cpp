@@ -56,38 +56,37 @@ inline bool hitPlayer(Enemy* e) {
 
 void initEnemies() {
 	numEnemies = 0;
+}
+
+uint8_t getNumEnemies() {
+	return numEnemies;
+}
 
-	for(uint8_t y = 0; y < NUM_TILES_Y; y++) {
-		for(uint8_t x = 0; x < NUM_TILES_X; x++) {
-			uint8_t tile = getTile(x, y);
-			if(tile == TILE_WYVERN || tile == TILE_WYVERN_2ND || tile == TILE_GHOST_LEFT || tile == TILE_GHOST_RIGHT || tile == TILE_GHOST_LEFT_2ND) {
-				if(numEnemies < MAX_ENEMIES) {
-					Enemy* e = &enemies[numEnemies++];
-					e->sprite = 0;
-
-					// use sprite index 1?
-					if(tile == TILE_WYVERN_2ND) {
-						tile = TILE_WYVERN;
-						e->sprite = 1;
-					}
-					if(tile == TILE_GHOST_LEFT_2ND) {
-						tile = TILE_GHOST_LEFT;
-						e->sprite = 1;
-					}
-
-					e->x = x * 8;
-					e->y = y * 8;
-					e->oy = e->y;
-					e->frame = tile;
-					e->dir = (tile == TILE_GHOST_LEFT ? -1 : 1);
-					e->walkPhase = numEnemies * 123;
-					e->updateFunc = (tile == TILE_WYVERN ? updateWyvern : updateGhost);
-					setTile(x, y, TILE_EMPTY);
-				}
-			}
+// enemies are spawned from room data while the room is decompressed
+// the enemy tile itself is replaced with an empty tile when the room is committed to tmap
+void spawnEnemy(uint8_t x, uint8_t y, uint8_t tile) {
+	if(numEnemies < MAX_ENEMIES) {
+		Enemy* e = &enemies[numEnemies++];
+		e->sprite = 0;
+
+		// use sprite index 1?
+		if(tile == TILE_WYVERN_2ND) {
+			tile = TILE_WYVERN;
+			e->sprite = 1;
+		}
+		if(tile == TILE_GHOST_LEFT_2ND) {
+			tile = TILE_GHOST_LEFT;
+			e->sprite = 1;
 		}
-	}
 
+		e->x = x * 8;
+		e->y = y * 8;
+		e->oy = e->y;
+		e->frame = tile;
+		e->dir = (tile == TILE_GHOST_LEFT ? -1 : 1);
+		e->walkPhase = numEnemies * 123;
+		e->updateFunc = (tile == TILE_WYVERN ? updateWyvern : updateGhost);
+	}
 }
 
 void updateEnemies() {
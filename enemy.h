@@ -39,7 +39,13 @@ struct Enemy {
 	void (*updateFunc)(Enemy* e);
 };
 
+inline bool isEnemyTile(uint8_t tile) {
+	return tile == TILE_WYVERN || tile == TILE_WYVERN_2ND || tile == TILE_GHOST_LEFT || tile == TILE_GHOST_RIGHT || tile == TILE_GHOST_LEFT_2ND;
+}
+
 void initEnemies();
+void spawnEnemy(uint8_t x, uint8_t y, uint8_t tile);	// tile must be an enemy tile
 void updateEnemies();
+uint8_t getNumEnemies();
 
 #endif
@@ -0,0 +1,78 @@
+// tqaudio: renders the music of tunedat.h the way the firmware plays it
+//
+// Usage: tqaudio [-n frames] out.wav
+//
+// The firmware mixes one buffer of 263 samples per frame and then advances the music by a frame (updateAudio
+// and updateMusic in ToorumsQuest2.ino), and the video interrupt plays one sample per scanline. The result is
+// an 8 bit WAV at the scanline rate, compare it with a capture from the simulator with tools/wavcmp.py.
+
+#include <stdio.h>
+#include <unistd.h>
+#include <arduino.h>
+#include "tq.h"
+#include "audio.h"
+#include "sfx.h"
+#include "playroutine.h"
+
+#define SAMPLES_PER_FRAME	263
+#define SAMPLE_RATE			15748		// 16 MHz / 1016 cycles per scanline
+
+static void writeLE(FILE* f, uint32_t value, int bytes) {
+	for(int i = 0; i < bytes; i++)
+		fputc((value >> (i * 8)) & 0xff, f);
+}
+
+int main(int argc, char** argv) {
+	long frames = 600;
+
+	int opt;
+	while((opt = getopt(argc, argv, "n:")) != -1) {
+		if(opt != 'n') {
+			fprintf(stderr, "usage: tqaudio [-n frames] out.wav\n");
+			return 2;
+		}
+		frames = atol(optarg);
+	}
+	if(optind != argc - 1) {
+		fprintf(stderr, "usage: tqaudio [-n frames] out.wav\n");
+		return 2;
+	}
+
+	FILE* f = fopen(argv[optind], "wb");
+	if(!f) {
+		perror(argv[optind]);
+		return 1;
+	}
+
+	uint32_t samples = frames * SAMPLES_PER_FRAME;
+	fwrite("RIFF", 1, 4, f);
+	writeLE(f, 36 + samples, 4);
+	fwrite("WAVEfmt ", 1, 8, f);
+	writeLE(f, 16, 4);
+	writeLE(f, 1, 2);				// PCM
+	writeLE(f, 1, 2);				// mono
+	writeLE(f, SAMPLE_RATE, 4);
+	writeLE(f, SAMPLE_RATE, 4);		// bytes per second
+	writeLE(f, 1, 2);				// block align
+	writeLE(f, 8, 2);				// bits per sample
+	fwrite("data", 1, 4, f);
+	writeLE(f, samples, 4);
+
+	initAudio();
+	initPlayroutine();
+
+	uint8_t buf[SAMPLES_PER_FRAME];
+	for(long i = 0; i < frames; i++) {
+		mixAudio(buf, SAMPLES_PER_FRAME);
+#ifdef ENABLE_MUSIC
+		updateSounds();
+		updatePlayroutine();
+		updateEffects();
+		updateEnvelopes();
+#endif
+		fwrite(buf, 1, SAMPLES_PER_FRAME, f);
+	}
+
+	fclose(f);
+	return 0;
+}
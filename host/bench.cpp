@@ -0,0 +1,398 @@
+// tqbench: times the game's hot routines on the host over fixed workloads
+//
+// Usage: tqbench [-t ms] [-j out.json] [-b baseline.json] [-r percent] [name...]
+//
+// Each benchmark runs in batches of at least -t milliseconds (50 by default), five times, and the fastest
+// batch gives the time per call. Only the named benchmarks run if any are given, an unknown name is a usage
+// error. -j writes the results as JSON, -b compares them with an earlier -j file and fails if a benchmark got
+// slower by more than -r percent (10 by default).
+//
+// The workloads do not depend on the clock or on earlier benchmarks, so runs of different builds can be
+// compared. Untimed preparation inside a benchmark reads the clock twice, the part of those reads that lands
+// in the timed code is measured at start up and subtracted. Timings are for the host, not the AVR: use them
+// to compare two versions of the code and check the winner in the simulator (sim/tqprof).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "gamepad.h"
+#include "player.h"
+#include "enemy.h"
+#include "room.h"
+#include "audio.h"
+#include "playroutine.h"
+#include "sfx.h"
+
+// flash data is defined where the sketch includes it, tqbench does not link the sketch
+#include "tiles.h"
+#include "font.h"
+#include "text.h"
+
+#define RUNS			5
+#define MAX_RESULTS		16
+
+extern Enemy	enemies[MAX_ENEMIES];
+extern uint8_t	numEnemies;
+void decompressRoom(uint8_t room);
+
+struct Benchmark {
+	const char*	name;
+	void		(*setup)();
+	void		(*run)(uint32_t i);
+};
+
+struct Result {
+	char		name[32];
+	double		ns;			// per call
+	uint32_t	calls;		// per batch
+};
+
+static double	pausedTime;		// seconds excluded from the current batch
+static double	pauseStart;
+static uint32_t	pauses;			// pauseTimer calls in the current batch
+static double	pauseCost;		// seconds a pauseTimer and resumeTimer pair adds to the batch time
+static uint32_t	rngState;
+
+static double now() {
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// untimed preparation inside a benchmark
+static void pauseTimer() {
+	pauses++;
+	pauseStart = now();
+}
+
+static void resumeTimer() {
+	pausedTime += now() - pauseStart;
+}
+
+static uint8_t random8() {
+	rngState = rngState * 1103515245 + 12345;
+	return rngState >> 16;
+}
+
+static void commitRoomNow() {
+	while(isRoomCommitPending())
+		runBlankTasks(1);
+}
+
+static void loadRoom(uint8_t room) {
+	initRoom(room);
+	commitRoomNow();
+}
+
+void recordingFinished() {
+}
+
+// rooms
+
+static void benchDecompressRoom(uint32_t i) {
+	decompressRoom(i % getNumRooms());
+}
+
+static void benchInitRoom(uint32_t i) {
+	// the room is usable once the commit is done, the firmware spreads it over blank lines
+	loadRoom(i % getNumRooms());
+}
+
+static void setupRoomState() {
+	clearRoomState();
+}
+
+static void benchStoreRoomState(uint32_t i) {
+	pauseTimer();
+	loadRoom(i % getNumRooms());
+	resumeTimer();
+	storeRoomState(i % getNumRooms());
+}
+
+static void benchRestoreRoomState(uint32_t i) {
+	// items are restored from roomstate while the room is committed to tmap
+	pauseTimer();
+	initRoom(i % getNumRooms());
+	resumeTimer();
+	commitRoomNow();
+}
+
+// game
+
+static void setupGame() {
+	rngState = 1;
+	clearRoomState();
+	initScreen();
+	loadRoom(0);
+	initPlayer();
+}
+
+static void benchUpdatePlayer(uint32_t i) {
+	// random buttons held for a few ticks each, movement and room changes like a player mashing buttons
+	pauseTimer();
+	if((i & 7) == 0) {
+		prevControllerState = controllerState;
+		controllerState = random8() & (BUTTON_A | BUTTON_LEFT | BUTTON_RIGHT | BUTTON_UP | BUTTON_DOWN);
+	}
+	if(p.gameover)
+		setupGame();
+	resumeTimer();
+
+	updatePlayer();
+
+	pauseTimer();
+	commitRoomNow();
+	resumeTimer();
+}
+
+static void setupEnemies() {
+	setupGame();
+
+	// the room with the most enemies
+	uint8_t best = 0;
+	uint8_t bestEnemies = 0;
+	for(uint8_t r = 0; r < getNumRooms(); r++) {
+		loadRoom(r);
+		if(numEnemies > bestEnemies) {
+			best = r;
+			bestEnemies = numEnemies;
+		}
+	}
+	loadRoom(best);
+	p.room = best;
+}
+
+static void benchUpdateEnemies(uint32_t) {
+	updateEnemies();
+}
+
+static void benchUpdateScoreBar(uint32_t i) {
+	p.score = i;
+	p.time = i << 4;
+	updateScoreBar();
+}
+
+// audio
+
+static void setupMusic() {
+	initAudio();
+	initPlayroutine();
+}
+
+static void benchPlayroutine(uint32_t) {
+	updatePlayroutine();
+	updateEffects();
+}
+
+static uint8_t mixBuffer[263];
+
+static void setupMix() {
+	setupMusic();
+
+	// a few seconds in, so that all channels are playing
+	for(int i = 0; i < 300; i++) {
+		mixAudio(mixBuffer, 263);
+		updatePlayroutine();
+		updateEffects();
+		updateEnvelopes();
+	}
+	playSound(SOUND_GOLD);
+	updateSounds();
+}
+
+static void benchMixAudio(uint32_t) {
+	mixAudio(mixBuffer, 263);
+}
+
+static const Benchmark benchmarks[] = {
+	{ "decompressRoom",		0,					benchDecompressRoom },
+	{ "initRoom",			setupRoomState,		benchInitRoom },
+	{ "storeRoomState",		setupRoomState,		benchStoreRoomState },
+	{ "restoreRoomState",	setupRoomState,		benchRestoreRoomState },
+	{ "updatePlayer",		setupGame,			benchUpdatePlayer },
+	{ "updateEnemies",		setupEnemies,		benchUpdateEnemies },
+	{ "updateScoreBar",		setupGame,			benchUpdateScoreBar },
+	{ "playroutine",		setupMusic,			benchPlayroutine },
+	{ "mixAudio",			setupMix,			benchMixAudio },
+};
+
+#define NUM_BENCHMARKS	(int)(sizeof(benchmarks) / sizeof(benchmarks[0]))
+
+static double runBatch(const Benchmark* b, uint32_t calls) {
+	pausedTime = 0;
+	pauses = 0;
+	double start = now();
+	for(uint32_t i = 0; i < calls; i++)
+		b->run(i);
+	double t = now() - start - pausedTime - pauses * pauseCost;
+	return t > 0 ? t : 0;
+}
+
+static void runBenchmark(const Benchmark* b, double minTime, Result* r) {
+	if(b->setup)
+		b->setup();
+
+	// grow the batch until it takes long enough to time
+	uint32_t calls = 1;
+	while(runBatch(b, calls) < minTime && calls < (1u << 30))
+		calls *= 2;
+
+	double best = 1e30;
+	for(int run = 0; run < RUNS; run++) {
+		if(b->setup)
+			b->setup();
+		double t = runBatch(b, calls);
+		if(t < best)
+			best = t;
+	}
+
+	snprintf(r->name, sizeof(r->name), "%s", b->name);
+	r->ns = best * 1e9 / calls;
+	r->calls = calls;
+}
+
+// clock overhead
+
+static void benchNothing(uint32_t) {
+}
+
+static void benchPause(uint32_t) {
+	pauseTimer();
+	resumeTimer();
+}
+
+// sets pauseCost to the time an empty untimed section adds to a call
+static void calibratePause(double minTime) {
+	static const Benchmark nothing = { "nothing", 0, benchNothing };
+	static const Benchmark pause = { "pause", 0, benchPause };
+	Result base, paused;
+	pauseCost = 0;
+	runBenchmark(&nothing, minTime, &base);
+	runBenchmark(&pause, minTime, &paused);
+	pauseCost = paused.ns > base.ns ? (paused.ns - base.ns) * 1e-9 : 0;
+}
+
+static void writeJson(const char* path, const Result* results, int n) {
+	FILE* f = fopen(path, "w");
+	if(!f) {
+		perror(path);
+		exit(1);
+	}
+	fprintf(f, "{\n  \"build\": \"0x%08x\",\n  \"benchmarks\": [\n", (uint32_t)BUILD_HASH);
+	for(int i = 0; i < n; i++)
+		fprintf(f, "    { \"name\": \"%s\", \"ns_per_call\": %.2f, \"calls\": %u }%s\n", results[i].name, results[i].ns,
+			results[i].calls, i + 1 < n ? "," : "");
+	fprintf(f, "  ]\n}\n");
+	fclose(f);
+}
+
+// reads the files written by writeJson, one benchmark per line
+static int readJson(const char* path, Result* results) {
+	FILE* f = fopen(path, "r");
+	if(!f) {
+		perror(path);
+		exit(1);
+	}
+	char line[256];
+	int n = 0;
+	while(fgets(line, sizeof(line), f) && n < MAX_RESULTS) {
+		Result* r = &results[n];
+		if(sscanf(line, " { \"name\": \"%31[^\"]\", \"ns_per_call\": %lf, \"calls\": %u", r->name, &r->ns, &r->calls) == 3)
+			n++;
+	}
+	fclose(f);
+	return n;
+}
+
+static const Benchmark* findBenchmark(const char* name) {
+	for(int i = 0; i < NUM_BENCHMARKS; i++)
+		if(strcmp(benchmarks[i].name, name) == 0)
+			return &benchmarks[i];
+	return 0;
+}
+
+static bool selected(const char* name, char** names, int numNames) {
+	if(numNames == 0)
+		return true;
+	for(int i = 0; i < numNames; i++)
+		if(strcmp(names[i], name) == 0)
+			return true;
+	return false;
+}
+
+int main(int argc, char** argv) {
+	double minTime = 0.05;
+	const char* jsonPath = 0;
+	const char* baselinePath = 0;
+	double threshold = 10;
+
+	int arg = 1;
+	for(; arg < argc && argv[arg][0] == '-'; arg++) {
+		if(arg + 1 == argc || strlen(argv[arg]) != 2) {
+			fprintf(stderr, "usage: tqbench [-t ms] [-j out.json] [-b baseline.json] [-r percent] [name...]\n");
+			return 2;
+		}
+		switch(argv[arg][1]) {
+		case 't': minTime = atof(argv[++arg]) / 1000; break;
+		case 'j': jsonPath = argv[++arg]; break;
+		case 'b': baselinePath = argv[++arg]; break;
+		case 'r': threshold = atof(argv[++arg]); break;
+		default:
+			fprintf(stderr, "usage: tqbench [-t ms] [-j out.json] [-b baseline.json] [-r percent] [name...]\n");
+			return 2;
+		}
+	}
+
+	for(int i = arg; i < argc; i++) {
+		if(!findBenchmark(argv[i])) {
+			fprintf(stderr, "tqbench: unknown benchmark %s, one of:", argv[i]);
+			for(int j = 0; j < NUM_BENCHMARKS; j++)
+				fprintf(stderr, " %s", benchmarks[j].name);
+			fprintf(stderr, "\n");
+			return 2;
+		}
+	}
+
+	Result baseline[MAX_RESULTS];
+	int numBaseline = baselinePath ? readJson(baselinePath, baseline) : 0;
+
+	Result results[MAX_RESULTS];
+	int n = 0;
+	int slower = 0;
+	calibratePause(minTime);
+	printf("untimed sections: %.1f ns of clock reads subtracted from each\n", pauseCost * 1e9);
+	printf("%-18s %12s %10s", "benchmark", "ns/call", "calls");
+	if(baselinePath)
+		printf(" %12s %8s", "baseline", "change");
+	printf("\n");
+
+	for(int i = 0; i < NUM_BENCHMARKS; i++) {
+		if(!selected(benchmarks[i].name, argv + arg, argc - arg))
+			continue;
+		Result* r = &results[n++];
+		runBenchmark(&benchmarks[i], minTime, r);
+		printf("%-18s %12.1f %10u", r->name, r->ns, r->calls);
+
+		for(int j = 0; j < numBaseline; j++) {
+			if(strcmp(baseline[j].name, r->name) == 0) {
+				double change = (r->ns / baseline[j].ns - 1) * 100;
+				printf(" %12.1f %+7.1f%%", baseline[j].ns, change);
+				if(change > threshold) {
+					printf("  SLOWER");
+					slower++;
+				}
+			}
+		}
+		printf("\n");
+	}
+
+	if(jsonPath)
+		writeJson(jsonPath, results, n);
+	if(slower) {
+		printf("FAIL: %d benchmarks more than %.0f%% slower than the baseline\n", slower, threshold);
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,90 @@
+// Host build: the controller reads come from a recording instead of the gamepad pins
+
+#include <stdio.h>
+#include <arduino.h>
+#include "gamepad.h"
+#include "host.h"
+
+uint8_t		controllerState = 0;
+uint8_t		prevControllerState = 0;
+
+Recording	recording;
+uint32_t	controllerReads;
+void		(*readHook)();
+
+static uint32_t	runPos;		// next run
+static uint8_t	runLeft;	// reads left in the current run
+
+static uint32_t readLE32(const uint8_t* p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+bool loadRecording(const char* path) {
+	FILE* f = fopen(path, "rb");
+	if(!f) {
+		perror(path);
+		return false;
+	}
+
+	uint8_t header[16];
+	if(fread(header, 1, sizeof(header), f) != sizeof(header) || memcmp(header, "TQR1", 4) != 0) {
+		fprintf(stderr, "%s: not a recording\n", path);
+		fclose(f);
+		return false;
+	}
+	if(header[8] != 0) {
+		fprintf(stderr, "%s: recording does not start at power up\n", path);
+		fclose(f);
+		return false;
+	}
+	recording.build = readLE32(header + 4);
+	recording.reads = readLE32(header + 12);
+
+	// runs are checked against the read count here, playback trusts them
+	uint32_t capacity = 256;
+	recording.runs = (uint8_t*)malloc(capacity);
+	recording.size = 0;
+	uint32_t reads = 0;
+	while(reads < recording.reads) {
+		int count = fgetc(f);
+		int buttons = fgetc(f);
+		if(buttons == EOF || count == 0) {
+			fprintf(stderr, "%s: recording is damaged after %u of %u reads\n", path, reads, recording.reads);
+			fclose(f);
+			return false;
+		}
+		if(recording.size == capacity) {
+			capacity *= 2;
+			recording.runs = (uint8_t*)realloc(recording.runs, capacity);
+		}
+		recording.runs[recording.size++] = count;
+		recording.runs[recording.size++] = buttons;
+		reads += count;
+	}
+	fclose(f);
+
+	runPos = 0;
+	runLeft = 0;
+	controllerReads = 0;
+	return true;
+}
+
+void initController() {
+}
+
+void updateController() {
+	if(controllerReads == recording.reads)
+		recordingFinished();
+	if(readHook)
+		readHook();
+
+	if(runLeft == 0) {
+		runLeft = recording.runs[runPos];
+		runPos += 2;
+	}
+	runLeft--;
+	controllerReads++;
+
+	prevControllerState = controllerState;
+	controllerState = recording.runs[runPos - 1];
+}
@@ -0,0 +1,23 @@
+// Host build: I/O registers and Arduino pin functions
+
+#include <arduino.h>
+
+volatile uint8_t PORTB, DDRB, PORTD, DDRD;
+volatile uint8_t TCCR1A, TCCR1B, TIMSK1, TCNT1L;
+volatile uint16_t ICR1, OCR1A;
+volatile uint8_t TCCR2A, TCCR2B, OCR2A;
+volatile uint8_t GPIOR0, GPIOR1, GPIOR2;
+volatile uint8_t SREG;
+
+void pinMode(uint8_t, uint8_t) {
+}
+
+void digitalWrite(uint8_t, uint8_t) {
+}
+
+int digitalRead(uint8_t) {
+	return HIGH;
+}
+
+void delayMicroseconds(unsigned int) {
+}
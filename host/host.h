@@ -0,0 +1,38 @@
+// Host build: what the host programs see of the stand-ins for the firmware's hardware code
+
+#ifndef HOST_H
+#define HOST_H
+
+#include <stdint.h>
+#include "videogen.h"
+
+// videogen_host.cpp
+extern uint32_t		hostFrames;			// waitForVBlank calls since start, frameCounter without the wrap
+extern uint8_t		videoMode;			// last setVideoMode
+extern void			(*frameHook)();		// called at the end of every waitForVBlank, 0 for none
+extern bool			blankTasksAtOnce;	// addBlankTask runs the tasks for a frame's worth of blank lines
+const Sprite*		activeSprites();	// sprites shown in the current frame
+void				runBlankTasks(int lines);	// what the video interrupt does on that many blank lines
+
+// gamepad_host.cpp, updateController plays back a recording made with tools/inputrec.py
+struct Recording {
+	uint32_t	build;		// hash of the sources it was made for, see BUILD_HASH
+	uint32_t	reads;		// controller reads
+	uint8_t*	runs;		// (count, buttons) pairs
+	uint32_t	size;		// bytes in runs
+};
+
+extern Recording	recording;
+extern uint32_t		controllerReads;	// updateController calls since start
+extern void			(*readHook)();		// called by updateController before each read, 0 for none
+
+bool loadRecording(const char* path);	// prints the error and returns false on failure
+
+// snapshot.cpp, game state at every controller read for tools/lockstep.py, see sim/snapshot.h
+bool openSnapshots(const char* path);	// sets readHook, prints the error and returns false on failure
+void closeSnapshots();
+
+// defined by the program, called by updateController when the game reads past the end of the recording
+void recordingFinished();
+
+#endif
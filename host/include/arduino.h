@@ -0,0 +1,31 @@
+// Host build: the parts of the Arduino core used by the game
+
+#ifndef HOST_ARDUINO_H
+#define HOST_ARDUINO_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <avr/io.h>
+#include <avr/interrupt.h>
+#include <avr/pgmspace.h>
+
+#define F_CPU		16000000UL
+
+#define HIGH		1
+#define LOW			0
+#define INPUT		0
+#define OUTPUT		1
+
+#define min(a,b)				((a)<(b)?(a):(b))
+#define max(a,b)				((a)>(b)?(a):(b))
+#define constrain(amt,low,high)	((amt)<(low)?(low):((amt)>(high)?(high):(amt)))
+
+typedef bool boolean;
+
+void pinMode(uint8_t pin, uint8_t mode);
+void digitalWrite(uint8_t pin, uint8_t value);
+int digitalRead(uint8_t pin);
+void delayMicroseconds(unsigned int us);
+
+#endif
@@ -0,0 +1,9 @@
+// Host build: there are no interrupts, the scanline work of the firmware is not emulated
+
+#ifndef HOST_AVR_INTERRUPT_H
+#define HOST_AVR_INTERRUPT_H
+
+#define cli()
+#define sei()
+
+#endif
@@ -0,0 +1,32 @@
+// Host build: I/O registers are plain variables, see host/hardware.cpp
+
+#ifndef HOST_AVR_IO_H
+#define HOST_AVR_IO_H
+
+#include <stdint.h>
+
+extern volatile uint8_t PORTB, DDRB, PORTD, DDRD;
+extern volatile uint8_t TCCR1A, TCCR1B, TIMSK1, TCNT1L;
+extern volatile uint16_t ICR1, OCR1A;
+extern volatile uint8_t TCCR2A, TCCR2B, OCR2A;
+extern volatile uint8_t GPIOR0, GPIOR1, GPIOR2;
+extern volatile uint8_t SREG;
+
+#define _BV(bit)			(1 << (bit))
+#define _SFR_IO_ADDR(reg)	0
+#define _SFR_MEM_ADDR(reg)	0
+
+#define COM1A0		6
+#define COM1A1		7
+#define WGM11		1
+#define WGM12		3
+#define WGM13		4
+#define CS10		0
+#define TOIE1		0
+#define WGM21		1
+#define COM2A0		6
+#define CS20		0
+
+#define RAMEND		0x8ff
+
+#endif
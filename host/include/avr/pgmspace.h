@@ -0,0 +1,25 @@
+// Host build: flash data lives in ordinary memory
+
+#ifndef HOST_AVR_PGMSPACE_H
+#define HOST_AVR_PGMSPACE_H
+
+#include <stdint.h>
+#include <string.h>
+
+#define PROGMEM
+
+typedef char			prog_char;
+typedef unsigned char	prog_uchar;
+typedef int8_t			prog_int8_t;
+typedef uint8_t			prog_uint8_t;
+typedef int16_t			prog_int16_t;
+typedef uint16_t		prog_uint16_t;
+
+#define pgm_read_byte(addr)			(*(const uint8_t*)(addr))
+#define pgm_read_byte_near(addr)	(*(const uint8_t*)(addr))
+#define pgm_read_word(addr)			(*(const uint16_t*)(addr))
+#define pgm_read_word_near(addr)	(*(const uint16_t*)(addr))
+#define memcpy_P					memcpy
+#define PSTR(s)						(s)
+
+#endif
@@ -0,0 +1,66 @@
+// tqreplay: plays a controller recording through the game logic on the host
+//
+// Usage: tqreplay [-q] [-c] [-s out.snap] recording.tqr
+//
+// Runs setup() and loop() of the sketch with the controller reads taken from the recording, as fast as the
+// host goes, and prints where the game ended up when the recording runs out. -q prints nothing but errors,
+// -s writes a game state snapshot at every read for tools/lockstep.py. -c commits rooms to tmap as soon as
+// initRoom returns instead of on the blank lines of the following frame, the game state at the reads must not
+// change with it.
+
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "host.h"
+#include "player.h"
+
+#ifndef BUILD_HASH
+#define BUILD_HASH	0
+#endif
+
+void setup();
+void loop();
+
+static bool		quiet;
+static clock_t	startTime;
+
+void recordingFinished() {
+	closeSnapshots();
+	if(!quiet) {
+		double seconds = (double)(clock() - startTime) / CLOCKS_PER_SEC;
+		printf("%u reads, %u frames (%.1f s at 60 Hz) in %.3f s\n", controllerReads, hostFrames, hostFrames / 60.0, seconds);
+		printf("room %u, x %d, y %d, score %u, health %u, time %u, gameover %u\n",
+			p.room, p.x, p.y, p.score, p.health, p.time >> 8, p.gameover);
+	}
+	exit(0);
+}
+
+int main(int argc, char** argv) {
+	const char* snapshotPath = 0;
+	int arg = 1;
+	for(; arg < argc - 1 && argv[arg][0] == '-'; arg++) {
+		if(strcmp(argv[arg], "-q") == 0)
+			quiet = true;
+		else if(strcmp(argv[arg], "-c") == 0)
+			blankTasksAtOnce = true;
+		else if(strcmp(argv[arg], "-s") == 0 && arg + 1 < argc - 1)
+			snapshotPath = argv[++arg];
+		else
+			break;
+	}
+	if(arg != argc - 1) {
+		fprintf(stderr, "usage: tqreplay [-q] [-c] [-s out.snap] recording.tqr\n");
+		return 2;
+	}
+	if(!loadRecording(argv[arg]))
+		return 1;
+	if(snapshotPath && !openSnapshots(snapshotPath))
+		return 1;
+	if(recording.build != BUILD_HASH)
+		fprintf(stderr, "%s: recorded on build 0x%08x, this is 0x%08x\n", argv[arg], recording.build, (uint32_t)BUILD_HASH);
+
+	startTime = clock();
+	setup();
+	loop();
+	return 0;
+}
@@ -0,0 +1,113 @@
+// Host build: game state snapshots in the layout of sim/snapshot.h, written by tqreplay -s
+
+#include <stdio.h>
+#include <string.h>
+#include "videogen.h"
+#include "room.h"
+#include "player.h"
+#include "enemy.h"
+#include "host.h"
+#include "sim/snapshot.h"
+
+extern Enemy	enemies[MAX_ENEMIES];
+extern uint8_t	numEnemies;
+void updateWyvern(Enemy* e);
+void updateGhost(Enemy* e);
+
+static FILE*	snapshotFile;
+
+static void put16(uint8_t* p, uint16_t v) {
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+	put16(p, v);
+	put16(p + 2, v >> 16);
+}
+
+// same rule as tqsnap, the array an entry points into is the closest one below. Pointers into different
+// arrays can't be compared in C++, so the addresses are compared as integers.
+static uint16_t tileIndex(const volatile uint8_t* ptr) {
+	uintptr_t p = (uintptr_t)ptr;
+	uintptr_t t = (uintptr_t)tiles;
+	uintptr_t f = (uintptr_t)font;
+	if(p >= t && (p < f || f < t))
+		return (p - t) / 64;
+	if(p >= f && p)
+		return SNAP_GLYPH + (p - f) / 8;
+	return SNAP_OTHER;
+}
+
+static uint8_t funcIndex(void (*func)(Enemy* e)) {
+	if(func == 0)
+		return SNAP_FUNC_NONE;
+	if(func == updateWyvern)
+		return SNAP_FUNC_WYVERN;
+	if(func == updateGhost)
+		return SNAP_FUNC_GHOST;
+	return SNAP_FUNC_OTHER;
+}
+
+static void writeSnapshot() {
+	uint8_t rec[SNAP_ROOMSTATE + 256];
+	put32(rec + SNAP_READ, controllerReads);
+	put32(rec + SNAP_FRAME, hostFrames);
+
+	uint8_t* r = rec + SNAP_PLAYER;
+	*r++ = p.frame;
+	*r++ = p.x;
+	*r++ = p.y;
+	*r++ = p.dir;
+	*r++ = p.walkPhase;
+	*r++ = p.room;
+	put16(r, p.score);
+	r += 2;
+	*r++ = p.health;
+	put16(r, p.time);
+	r += 2;
+	*r++ = p.vely;
+	*r++ = p.jumpTimer;
+	*r++ = p.climbing;
+	*r++ = p.climbPhase;
+	*r++ = p.hurtTimer;
+	*r++ = p.gameover;
+
+	rec[SNAP_NUM_ENEMIES] = numEnemies;
+	for(int i = 0; i < SNAP_MAX_ENEMIES; i++) {
+		const Enemy* e = &enemies[i];
+		r = rec + SNAP_ENEMIES + i * SNAP_ENEMY_SIZE;
+		*r++ = e->x;
+		*r++ = e->y;
+		*r++ = e->oy;
+		*r++ = e->dir;
+		*r++ = e->frame;
+		*r++ = e->walkPhase;
+		*r++ = e->sprite;
+		*r++ = funcIndex(e->updateFunc);
+	}
+
+	for(int i = 0; i < SNAP_TMAP_SIZE; i++)
+		put16(rec + SNAP_TMAP + i * 2, tileIndex(tmap[i]));
+	memcpy(rec + SNAP_ROOMSTATE, getRoomState(), getNumRooms());
+	fwrite(rec, 1, SNAP_ROOMSTATE + getNumRooms(), snapshotFile);
+}
+
+bool openSnapshots(const char* path) {
+	snapshotFile = fopen(path, "wb");
+	if(!snapshotFile) {
+		perror(path);
+		return false;
+	}
+	uint8_t header[6];
+	memcpy(header, SNAP_MAGIC, 4);
+	put16(header + 4, SNAP_ROOMSTATE + getNumRooms());
+	fwrite(header, 1, sizeof(header), snapshotFile);
+	readHook = writeSnapshot;
+	return true;
+}
+
+void closeSnapshots() {
+	if(snapshotFile)
+		fclose(snapshotFile);
+}
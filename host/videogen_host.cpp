@@ -0,0 +1,227 @@
+// Host build: the parts of videogen*.cpp the game logic talks to
+//
+// There is no video signal. The tile map and the sprite tables are kept as in the firmware, so the game sees
+// the same screen state, and waitForVBlank stands in for the video interrupt: it counts a frame, swaps the
+// sprite tables like vsync_line and runs the blank line tasks on as many blank lines as the video mode's
+// display list leaves, each line running the tasks that fit in it by their worst case cycles.
+// With blankTasksAtOnce set, addBlankTask also runs them right away, so a room is in tmap as soon as initRoom
+// returns, like before the room commit was spread over blank lines.
+
+#include <arduino.h>
+#include "videogen.h"
+#include "host.h"
+
+#define CYCLES_PER_LINE			(SCANLINE_CYCLES - 1)
+#define BLANK_TASK_START		100		// TCNT1 when blank_line gets to its tasks: entry, prologue, outputAudioSample
+											// and the scanLine bookkeeping
+
+// region heights of the display lists in videogen.cpp, 0 ends a list
+static const uint8_t		tilesAndSpritesLines[] = { 8*2, (NUM_TILES_Y-1)*8*2 + 2, 0 };	// lowresList too
+static const uint8_t		messageLines[] = { 8*2, (MESSAGE_ROW-1)*8*2 + 2, 7*2, (NUM_TILES_Y-1-MESSAGE_ROW)*8*2 + 2, 0 };
+static const uint8_t		fullScreenLines[] = { SCREEN_HEIGHT*2, 0 };	// introList and titlescreenList
+static const uint8_t		wideLines[] = { WIDE_TILES_Y*8*3 + 3, 0 };
+
+volatile int				scanLine;
+volatile uint8_t			frameCounter;
+uint32_t					hostFrames;
+void						(*interruptRoutine)();
+int							regionEnd;
+
+volatile uint8_t*			tmap[NUM_TILES_X*NUM_TILES_Y];
+volatile uint8_t**			tmapPtr = tmap;
+volatile uint8_t			tileOffset;
+uint8_t						linebuf[LINEBUF_SIZE];
+uint8_t*					linebuf1 = linebuf;
+uint8_t*					linebuf2 = linebuf + LINEBUF_SIZE/2;
+volatile SpriteLine			spriteBuffer[NUM_SPRITES*(SPRITE_LINES+1)];
+volatile SpriteLine*		spriteBufferPtr = spriteBuffer;
+volatile SpriteLine			emptySpriteLine[NUM_SPRITES];
+
+uint8_t						videoMode;
+void						(*frameHook)();
+bool						blankTasksAtOnce;
+
+static Sprite				sprites[3][SPRITE_TABLE_SIZE];
+static Sprite*				spriteWritePtr = sprites[0];
+static Sprite*				spritePendingPtr = sprites[1];
+static Sprite*				spriteActivePtr = sprites[2];
+static bool					spritesPresented;
+static uint8_t				spriteWriteCount;
+
+struct BlankTask {
+	void		(*func)();
+	uint16_t	cycles;
+};
+
+static BlankTask			blankTasks[MAX_BLANK_TASKS];
+static uint8_t				numBlankTasks;
+static uint8_t				nextBlankTask;
+static int					blankLines;		// lines with blank line tasks in each frame of the current display list
+
+void initScreen() {
+	initSprites();
+	setVideoMode(VIDMODE_TILES_AND_SPRITES);
+}
+
+// blank_line runs the tasks from the end of vsync to the line that starts the display list and from the
+// region_line that ends it to the end of the frame, each region after the first costs a region_line
+static void setDisplayLines(const uint8_t* regions, int startLine) {
+	int end = startLine;
+	for(; *regions != 0; regions++)
+		end += *regions + 1;
+	blankLines = (startLine - _NTSC_LINE_STOP_VSYNC) + (_NTSC_LINE_FRAME - end);
+}
+
+void setVideoMode(uint8_t mode) {
+	videoMode = mode;
+	switch(mode) {
+	case VIDMODE_TILES_AND_SPRITES:
+	case VIDMODE_LOWRES:
+		setDisplayLines(tilesAndSpritesLines, SCREEN_START);
+		break;
+
+	case VIDMODE_INTRO:
+	case VIDMODE_TITLESCREEN:
+		setDisplayLines(fullScreenLines, SCREEN_START);
+		break;
+
+	case VIDMODE_MESSAGE:
+		setDisplayLines(messageLines, SCREEN_START);
+		break;
+
+	case VIDMODE_WIDE:
+		setDisplayLines(wideLines, SCREEN_START);
+		break;
+	}
+}
+
+void setDisplayList(const DisplayRegion*, int) {
+}
+
+void showMessage(uint8_t, const prog_uchar*) {
+	setVideoMode(VIDMODE_MESSAGE);
+}
+
+bool addBlankTask(void (*func)(), uint16_t cycles) {
+	uint8_t i = 0;
+	while(i < numBlankTasks && blankTasks[i].func != func)
+		i++;
+
+	if(i == numBlankTasks) {
+		if(numBlankTasks == MAX_BLANK_TASKS || cycles > CYCLES_PER_LINE - BLANK_TASK_MARGIN)
+			return false;
+		blankTasks[numBlankTasks].func = func;
+		blankTasks[numBlankTasks].cycles = cycles;
+		numBlankTasks++;
+	}
+
+	if(blankTasksAtOnce)
+		runBlankTasks(blankLines);
+	return true;
+}
+
+void removeBlankTask(void (*func)()) {
+	for(uint8_t i = 0; i < numBlankTasks; i++) {
+		if(blankTasks[i].func == func) {
+			numBlankTasks--;
+			for(; i < numBlankTasks; i++)
+				blankTasks[i] = blankTasks[i+1];
+			break;
+		}
+	}
+}
+
+// round robin like runBlankTasks in videogen.cpp, with the worst case cycles of each task in place of TCNT1
+void runBlankTasks(int lines) {
+	for(int line = 0; line < lines; line++) {
+		uint16_t time = BLANK_TASK_START;
+		for(uint8_t n = numBlankTasks; n > 0; n--) {
+			if(nextBlankTask >= numBlankTasks)
+				nextBlankTask = 0;
+			BlankTask* t = &blankTasks[nextBlankTask++];
+			if(time + t->cycles <= CYCLES_PER_LINE - BLANK_TASK_MARGIN) {
+				time += t->cycles;
+				t->func();
+			}
+		}
+	}
+}
+
+uint8_t waitForVBlank() {
+	frameCounter++;
+	hostFrames++;
+	swapSprites();
+	runBlankTasks(blankLines);
+
+	if(frameHook)
+		frameHook();
+	return 1;
+}
+
+void initSprites() {
+	for(uint8_t i = 0; i < 3; i++)
+		for(uint8_t j = 0; j < SPRITE_TABLE_SIZE; j++)
+			sprites[i][j].y = 0;
+}
+
+void clearSprites() {
+	for(uint8_t i = 0; i < SPRITE_TABLE_SIZE; i++) {
+		spriteWritePtr[i].img = 0;
+		spriteWritePtr[i].y = 0;
+	}
+	spriteWriteCount = 0;
+}
+
+void updateSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y) {
+	if(spriteWriteCount == SPRITE_TABLE_SIZE)
+		return;
+	if(x <= -8 || x >= SCREEN_WIDTH) {
+		x = 0;
+		y = 0;
+	}
+
+	Sprite* s = &spriteWritePtr[spriteWriteCount++];
+	s->img = img | (sp << 6);
+	s->x = x;
+	s->y = y;
+}
+
+void presentSprites() {
+	Sprite* tmp = spritePendingPtr;
+	spritePendingPtr = spriteWritePtr;
+	spriteWritePtr = tmp;
+	spritesPresented = true;
+}
+
+void swapSprites() {
+	if(spritesPresented) {
+		Sprite* tmp = spriteActivePtr;
+		spriteActivePtr = spritePendingPtr;
+		spritePendingPtr = tmp;
+		spritesPresented = false;
+	}
+}
+
+const Sprite* activeSprites() {
+	return spriteActivePtr;
+}
+
+void clearScreen() {
+	for(uint8_t i = 0; i < NUM_TILES_X*NUM_TILES_Y; i++)
+		setGlyph(i, GLYPH_SPACE);
+}
+
+void drawText(uint8_t x, uint8_t y, const prog_uchar* text) {
+	uint8_t ox = x;
+	uint8_t glyph;
+	while((glyph = pgm_read_byte_near(text++)) != GLYPH_END) {
+		if(glyph == GLYPH_NEWLINE) {
+			x = ox;
+			y++;
+			continue;
+		}
+		if(x < NUM_TILES_X && y < NUM_TILES_Y)
+			setGlyph(y * NUM_TILES_X + x, glyph);
+		x++;
+	}
+}
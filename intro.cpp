@@ -28,54 +28,37 @@
 #include "playroutine.h"
 #include "audio.h"
 
-PROGMEM prog_char intro1[] =
-	"OH NO!\n\n"
-	"TOORUM'S BE-\n"
-	"LOVED PRINCESS\n"
-	"ADELA HAS BEEN\n"
-	"KIDNAPPED BY\n"
-	"EVIL MAHARADJA\n"
-	"KOVALSKY!\n";
-
-PROGMEM prog_char intro2[] =
-	"HELP TOORUM\n"
-	"FIND THE PRIN-\n"
-	"CESS BEFORE\n"
-	"THE MAHARADJA\n"
-	"SEDUCES HER!\n\n"
-	"GO!!!";
-
 void updateAudio();
 
-void textWriter(prog_char* text) {
+// types out a glyph string from text.h
+void textWriter(const prog_uchar* text) {
 	uint8_t x = 0;
 	uint8_t y = 0;
-	char ch = 0xff;
+	uint8_t glyph = 0;
 	bool slow = true;
 
 	clearScreen();
 
 	while(true) {
 		while(true) {
-			ch = pgm_read_byte_near(text);
-			if(ch != 0) {
-				if(ch == '\n') {
+			glyph = pgm_read_byte_near(text);
+			if(glyph != GLYPH_END) {
+				if(glyph == GLYPH_NEWLINE) {
 					x = 0;
 					y++;
 				} else {
-					uint8_t tile = charToTile(ch);
-					setTile(y * 14 + x, tile);
+					setGlyph(y * 14 + x, glyph);
 			 		x++;
 			 	}
 			 	text++;
 			}
-			if(slow || ch == 0)
+			if(slow || glyph == GLYPH_END)
 				break;
 		}
 
 		updateController();
 		if(y > 0 && (controllerState & (BUTTON_A|BUTTON_START)) && prevControllerState == 0) {
-			if(ch == 0)
+			if(glyph == GLYPH_END)
 				break;
 			else
 				slow = false;
@@ -108,7 +91,7 @@ void title() {
 void intro() {
 	title();
 	setVideoMode(VIDMODE_INTRO);
-	textWriter(intro1);
-	textWriter(intro2);
+	textWriter(textIntro1);
+	textWriter(textIntro2);
 	clearScreen();
 }
@@ -29,9 +29,22 @@
 #include "videogen.h"
 #include "audio.h"
 #include "sfx.h"
+#include "profile.h"
+#include "trace.h"
 
 Player p;
 
+// score bar row is built here and committed to tmap on a blank line
+// the first HUD_TEXT_TILES entries are glyphs, the rest are tiles
+#define SCORE_BAR_CYCLES	320
+
+#if MAX_HEALTH > NUM_TILES_X - HUD_TEXT_TILES
+#error hearts do not fit in the tile part of the score bar
+#endif
+
+static uint8_t scoreBar[NUM_TILES_X];
+static volatile bool scoreBarDirty = false;
+
 inline void updateMoving();
 inline void updateClimbing();
 inline void updatePickup();
@@ -60,7 +73,22 @@ bool canStandOn(int8_t x, int8_t y) {
 	return tile == TILE_WALL || tile == TILE_WALL_DARK || tile == TILE_DOOR || tile == TILE_LADDER;
 }
 
+// blank line task
+static void commitScoreBar() {
+	if(!scoreBarDirty)
+		return;
+	TRACE_ISR_BEGIN(TRACE_SCORE_COMMIT);
+	for(uint8_t i = 0; i < HUD_TEXT_TILES; i++)
+		tmap[i] = &font[scoreBar[i] * 8];
+	for(uint8_t i = HUD_TEXT_TILES; i < NUM_TILES_X; i++)
+		tmap[i] = &tiles[scoreBar[i] * 64];
+	scoreBarDirty = false;
+	TRACE_ISR_END(TRACE_SCORE_COMMIT);
+}
+
 void initPlayer() {
+	addBlankTask(commitScoreBar, SCORE_BAR_CYCLES);
+
 	p.frame = TILE_PLAYER_RIGHT;
 	p.x = 4*8;
 	p.y = 4*8;
@@ -93,13 +121,13 @@ void updatePlayer() {
 
 void gameover() {
 	playSound(SOUND_GAME_OVER);
-	drawText(2, 5, "GAME OVER");
+	showMessage(2, textGameOver);
 	p.gameover = 1;
 }
 
 void winGame() {
 	if(p.gameover == 0) {
-		drawText(3, 5, "YOU WIN");
+		showMessage(2, textYouWin);
 		p.gameover = 2;
 		p.score += 2000;
 	}
@@ -152,7 +180,8 @@ inline void updatePickup() {
 				// pick up key
 				setTile(i, TILE_EMPTY);
 				playSound(SOUND_GOLD);
-				for(uint8_t i = 0; i < NUM_TILES_X*NUM_TILES_Y; i++)
+				// doors are in the room rows only, the score bar row holds glyphs
+				for(uint8_t i = NUM_TILES_X; i < NUM_TILES_X*NUM_TILES_Y; i++)
 					if(getTile(i) == TILE_DOOR)
 						setTile(i, TILE_EMPTY);
 			}
@@ -280,15 +309,17 @@ static void changeRoom(uint8_t room) {
 	storeRoomState(p.room);
 	p.room = room;
 	initRoom(room);
-	restoreRoomState(room);
 }
 
+// at most one room change per tick: the next storeRoomState would read tmap before the new room is
+// committed to it. A corner exit takes the second change on the next tick.
 inline void updateCurrentRoom() {
 	if(p.x <= -8) {
 		uint8_t r = getAdjacentRoom(p.room, 0);
 		if(r != 0xff) {
 			changeRoom(r);
 			p.x = SCREEN_WIDTH - 8;
+			return;
 		}
 	}
 
@@ -297,6 +328,7 @@ inline void updateCurrentRoom() {
 		if(r != 0xff) {
 			changeRoom(r);
 			p.x = 0;
+			return;
 		}
 	}
 
@@ -305,6 +337,7 @@ inline void updateCurrentRoom() {
 		if(r != 0xff) {
 			changeRoom(r);
 			p.y = SCREEN_HEIGHT - 4;	
+			return;
 		}
 	}
 
@@ -330,27 +363,31 @@ inline void updateHurt() {
 }
 
 void updateScoreBar() {
-	for(uint8_t i = 0; i < NUM_TILES_X; i++)
-		setTile(i, TILE_EMPTY);
+	// hold back the commit while the row is being rebuilt
+	scoreBarDirty = false;
 
-	// update score
-#ifdef DEBUG_SCANLINES
-	uint16_t score = p.updateScanlines;
+	for(uint8_t i = 0; i < HUD_TEXT_TILES; i++)
+		scoreBar[i] = GLYPH_SPACE;
+	for(uint8_t i = HUD_TEXT_TILES; i < NUM_TILES_X; i++)
+		scoreBar[i] = TILE_EMPTY;
+
+#ifdef DEBUG_PROFILE
+	drawProfile(scoreBar);
 #else
+	// update score
 	uint16_t score = p.score;
-#endif
 	uint16_t s = 10000;
 	for(uint8_t i = 0; i < 5; i++) {
 		uint8_t n = score / s;
 		score -= n * s;
 		s /= 10;
-		setTile(i, 0, 32 + 34 + n);
+		scoreBar[i] = GLYPH_DIGITS + n;
 	}
 
 	// clear leading zeros
 	for(uint8_t i = 0; i < 4; i++) {
-		if(getTile(i, 0) == 32 + 34)
-			setTile(i, 0, TILE_EMPTY);
+		if(scoreBar[i] == GLYPH_DIGITS)
+			scoreBar[i] = GLYPH_SPACE;
 		else
 			break;
 	}
@@ -363,14 +400,17 @@ void updateScoreBar() {
 			uint8_t n = time / s;
 			time -= n * s;
 			s /= 10;
-			setTile(6 + i, 0, 32 + 34 + n);
+			scoreBar[6 + i] = GLYPH_DIGITS + n;
 		}
 	}
+#endif
 
 	// update hearts
 	for(uint8_t i = 0; i < p.health; i++) {
-		setTile(12 - i, 0, TILE_HEART);
+		scoreBar[NUM_TILES_X - 1 - i] = TILE_HEART;
 	}
+
+	scoreBarDirty = true;
 }
 
 inline void updateTime() {
@@ -41,7 +41,6 @@ struct Player {
 	uint8_t		climbPhase;
 	uint8_t		hurtTimer;
 	uint8_t		gameover;			// 0 = game not over, 1 = game over, 2 = game won
-	uint8_t		updateScanlines;	// DEBUG: this many scanlines is spent in game update
 };
 
 void initPlayer();
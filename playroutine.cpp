@@ -48,10 +48,10 @@ static PROGMEM prog_char sintab[] =
 };
 
 PROGMEM prog_uchar arpeggios[] = {
-	0,4,7,-1,-1,
-	0,3,7,-1,-1,	
-	0,4,7,10,-1,
-	0,12,-1,-1,-1,
+	0,4,7,0xff,0xff,
+	0,3,7,0xff,0xff,	
+	0,4,7,10,0xff,
+	0,12,0xff,0xff,0xff,
 };
 
 Channel channel[OSCILLATORS];
@@ -0,0 +1,181 @@
+/*
+ Toorum's Quest II
+ Copyright (c) 2013 Petri Hakkinen
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions: 
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+*/
+
+#include <arduino.h>
+#include "profile.h"
+#include "videogen.h"
+#include "gamepad.h"
+
+#ifdef DEBUG_PROFILE
+
+#if NUM_PROFILE_STAGES + 1 > HUD_TEXT_TILES
+#error the stages and the W of page 2 do not fit in the score bar text
+#endif
+
+// scanlines from one vsync to the next, the vsync line resets scanLine after LINES_PER_FRAME
+#define PROFILE_FRAME_LINES	(_NTSC_LINE_FRAME + 1)
+
+static uint8_t	startFrame;
+static int		startLine;
+
+static uint8_t	tickLines[NUM_PROFILE_STAGES];		// this tick
+static uint8_t	windowLines[NUM_PROFILE_STAGES];	// max of this window
+static uint8_t	shownLines[NUM_PROFILE_STAGES];		// max of the last full window
+static uint8_t	worstLines[NUM_PROFILE_STAGES];		// tick with the most lines in total
+static uint16_t	worstTotal;
+static uint8_t	windowTicks;
+static uint8_t	page;
+
+uint16_t		minFreeRam;
+
+extern uint8_t	__heap_start;	// end of globals, the heap is not used
+
+// paints RAM from the end of the globals to the top of the stack before anything is on the stack,
+// runs from the startup code before main so it cannot use the stack itself
+void paintFreeRam() __attribute__((naked, used, section(".init3")));
+
+void paintFreeRam() {
+	__asm__ __volatile__ (
+		"ldi	r30, lo8(__heap_start)\n\t"
+		"ldi	r31, hi8(__heap_start)\n\t"
+		"ldi	r24, %[canary]\n\t"
+		"ldi	r25, hi8(%[end])\n\t"
+		"rjmp	2f\n\t"
+	"1:\n\t"
+		"st		Z+, r24\n\t"
+	"2:\n\t"
+		"cpi	r30, lo8(%[end])\n\t"
+		"cpc	r31, r25\n\t"
+		"brlo	1b\n\t"
+		:
+		: [canary] "n" (PROFILE_CANARY),
+		[end] "n" (RAMEND)
+		: "r24", "r25", "r30", "r31"
+	);
+}
+
+// counts the canary bytes left above the globals
+uint16_t updateMinFreeRam() {
+	const uint8_t* p = &__heap_start;
+	while(*p == PROFILE_CANARY && p < (const uint8_t*)RAMEND)
+		p++;
+	minFreeRam = p - &__heap_start;
+	return minFreeRam;
+}
+
+void profileBegin() {
+	uint8_t sreg = SREG;
+	cli();
+	startFrame = frameCounter;
+	startLine = scanLine;
+	SREG = sreg;
+}
+
+void profileEnd(uint8_t stage) {
+	uint8_t sreg = SREG;
+	cli();
+	uint8_t frame = frameCounter;
+	int line = scanLine;
+	SREG = sreg;
+
+	uint16_t lines = (uint8_t)(frame - startFrame) * PROFILE_FRAME_LINES + line - startLine;
+	lines += tickLines[stage];
+	tickLines[stage] = (lines > 255 ? 255 : lines);
+
+	startFrame = frame;
+	startLine = line;
+}
+
+void profileEndTick() {
+	uint16_t total = 0;
+	for(uint8_t i = 0; i < NUM_PROFILE_STAGES; i++) {
+		total += tickLines[i];
+		if(tickLines[i] > windowLines[i])
+			windowLines[i] = tickLines[i];
+	}
+
+	if(total > worstTotal) {
+		worstTotal = total;
+		memcpy(worstLines, tickLines, NUM_PROFILE_STAGES);
+	}
+	memset(tickLines, 0, NUM_PROFILE_STAGES);
+
+	if(++windowTicks == PROFILE_WINDOW) {
+		windowTicks = 0;
+		memcpy(shownLines, windowLines, NUM_PROFILE_STAGES);
+		memset(windowLines, 0, NUM_PROFILE_STAGES);
+		updateMinFreeRam();
+	}
+}
+
+// writes n as digits glyphs with leading zeros
+static void drawNumber(uint8_t* dst, uint16_t n, uint8_t digits) {
+	while(digits--) {
+		dst[digits] = GLYPH_DIGITS + n % 10;
+		n /= 10;
+	}
+}
+
+// writes the current page to the HUD_TEXT_TILES glyphs at dst
+void drawProfile(uint8_t* dst) {
+	if(controllerState & ~prevControllerState & BUTTON_SELECT)
+		page = (page + 1) % PROFILE_PAGES;
+
+	if(page == 2) {
+		static const char label[] = "FREE";
+		for(uint8_t i = 0; i < 4; i++)
+			dst[i] = charToGlyph(label[i]);
+
+		drawNumber(dst + 5, minFreeRam, 4);
+		return;
+	}
+
+#ifdef DEBUG_JITTER
+	if(page == 3) {
+		dst[0] = charToGlyph('J');
+		drawNumber(dst + 2, jitterFrameMax, 3);
+		drawNumber(dst + 6, jitterMax, 3);
+		return;
+	}
+#endif
+
+	const uint8_t* lines = shownLines;
+	if(page == 1) {
+		if(controllerState & BUTTON_B) {
+			worstTotal = 0;
+			memset(worstLines, 0, NUM_PROFILE_STAGES);
+		}
+		lines = worstLines;
+		dst[NUM_PROFILE_STAGES] = charToGlyph('W');
+	}
+
+	for(uint8_t i = 0; i < NUM_PROFILE_STAGES; i++) {
+		uint8_t n = lines[i];
+		if(n < 10)
+			dst[i] = GLYPH_DIGITS + n;
+		else
+			dst[i] = charToGlyph(n < 36 ? 'A' + n - 10 : '!');
+	}
+}
+
+#endif
@@ -0,0 +1,90 @@
+/*
+ Toorum's Quest II
+ Copyright (c) 2013 Petri Hakkinen
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions: 
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+*/
+
+// Scanline profiler and free RAM meter for DEBUG_PROFILE builds
+//
+// Each stage of the main loop is timestamped in scanlines. The lines spent in each stage are summed over a
+// game tick. The overlay is shown in place of score and time. Each press of select shows the next of its
+// PROFILE_PAGES pages, after the last one it starts over:
+// 1. the maximum of each stage over the last PROFILE_WINDOW ticks, one digit per stage in base 36
+//    (0-9, A-Z, ! for 36 lines or more)
+// 2. the tick with the most lines in total, marked with a W after the last stage. It stays latched when another page is shown,
+//    holding B while this page is shown clears it
+// 3. the fewest free bytes of RAM seen between the globals and the stack
+// 4. with DEBUG_JITTER, J followed by the latest scanline interrupt entry (TCNT1L) of the last frame and
+//    since power up, see jitterHistogram in videogen.h for the whole distribution
+//
+// Stage order on screen: controller, sprites, player, tiles, enemies, hud, mix, music, commit wait.
+//
+// Free RAM is painted with PROFILE_CANARY before the globals are initialized. The stack overwrites the canary
+// as it grows, so the canary bytes left above the globals are the headroom that has never been used.
+// minFreeRam is updated at the end of every window, a simulator can read it from the symbol of the same name.
+
+#ifndef PROFILE_H
+#define PROFILE_H
+
+#include "tq.h"
+
+#define PROFILE_CONTROLLER	0
+#define PROFILE_SPRITES		1		// clearSprites and presentSprites
+#define PROFILE_PLAYER		2
+#define PROFILE_TILES		3
+#define PROFILE_ENEMIES		4
+#define PROFILE_HUD			5
+#define PROFILE_MIX			6
+#define PROFILE_MUSIC		7
+#define PROFILE_COMMIT		8		// waiting for a room to be committed to tmap
+#define NUM_PROFILE_STAGES	9
+
+#define PROFILE_WINDOW		32		// ticks, about one second
+#define PROFILE_CANARY		0xc5
+
+#ifdef DEBUG_JITTER
+#define PROFILE_PAGES		4
+#else
+#define PROFILE_PAGES		3
+#endif
+
+#ifdef DEBUG_PROFILE
+
+#define PROFILE_BEGIN()			profileBegin()
+#define PROFILE_END(stage)		profileEnd(stage)
+#define PROFILE_END_TICK()		profileEndTick()
+
+void profileBegin();
+void profileEnd(uint8_t stage);
+void profileEndTick();
+void drawProfile(uint8_t* dst);
+uint16_t updateMinFreeRam();
+
+extern uint16_t minFreeRam;
+
+#else
+
+#define PROFILE_BEGIN()
+#define PROFILE_END(stage)
+#define PROFILE_END_TICK()
+
+#endif
+
+#endif
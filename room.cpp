@@ -27,10 +27,14 @@
 #include "roomdat_compressed.h"
 #include "enemy.h"
 #include "videogen.h"
+#include "trace.h"
 
 #define ROOM_SIZE		(NUM_TILES_X*(NUM_TILES_Y-1))
 #define NUM_ROOMS		(sizeof(roomadj) / 4)
 
+#define ROOM_COMMIT_TILES		7		// tiles committed to tmap per blank line
+#define ROOM_COMMIT_CYCLES		400
+
 static uint8_t roomstate[NUM_ROOMS];
 
 // room decompression routines
@@ -38,26 +42,45 @@ static uint8_t roomstate[NUM_ROOMS];
 // high nibble of each compressed byte holds row length
 // low nibble store 4-bit tile
 
-static const prog_uchar* decompressPtr;
-static uint8_t decompressData;
-static uint8_t decompressRowLength;
+struct Decompressor {
+	const prog_uchar*	ptr;
+	uint8_t				data;
+	uint8_t				rowLength;
+};
+
+static Decompressor decompressor;
+
+// new room is committed to tmap by a blank line task so that it never shows up half drawn
+struct RoomCommit {
+	Decompressor		dec;
+	uint8_t				state;		// collected items of the room
+	uint8_t				bit;		// roomstate bit of next collectible
+	uint8_t				enemies;	// enemy tiles removed so far
+	volatile uint8_t	pos;		// next tile to commit, ROOM_SIZE when done
+};
+
+static RoomCommit commit = { { 0, 0, 0 }, 0, 0, 0, ROOM_SIZE };
+
+inline uint8_t decompressByte(Decompressor* d) {
+	if(d->rowLength == 0) {
+		d->data = pgm_read_byte_near(d->ptr);
+		d->ptr++;
+		d->rowLength = d->data >> 4;
+		d->data = pgm_read_byte_near(roomNibbleToByte + (d->data & 15));
+	}
+	d->rowLength--;
+	return d->data;
+}
 
 uint8_t decompressByte() {
-	if(decompressRowLength == 0) {
-		decompressData = pgm_read_byte_near(decompressPtr);
-		decompressPtr++;
-		decompressRowLength = decompressData >> 4;
-		decompressData = pgm_read_byte_near(roomNibbleToByte + (decompressData & 15));
-	}
-	decompressRowLength--;
-	return decompressData;
+	return decompressByte(&decompressor);
 }
 
 void decompressRoom(uint8_t room) {
 	// init decompression state
-	decompressPtr = rooms;
-	decompressData = 0;
-	decompressRowLength = 0;
+	decompressor.ptr = rooms;
+	decompressor.data = 0;
+	decompressor.rowLength = 0;
 
 	// skip rooms
 	for(int i = 0; i < room * ROOM_SIZE; i++)
@@ -68,13 +91,64 @@ inline bool isCollectible(uint8_t tile) {
 	return tile == TILE_KEY || tile == TILE_HEART || tile == TILE_GOLD || tile == TILE_DOOR;
 }
 
+// blank line task, writes a few tiles of the new room to tmap
+static void commitRoom() {
+	uint8_t i = commit.pos;
+	if(i >= ROOM_SIZE)
+		return;
+	TRACE_ISR_BEGIN(TRACE_ROOM_COMMIT);
+
+	uint8_t end = min(i + ROOM_COMMIT_TILES, ROOM_SIZE);
+	for(; i < end; i++) {
+		uint8_t tile = decompressByte(&commit.dec);
+		if(isCollectible(tile)) {
+			// item has been picked up earlier?
+			if(commit.state & commit.bit)
+				tile = TILE_EMPTY;
+			commit.bit <<= 1;
+		} else if(isEnemyTile(tile) && commit.enemies < MAX_ENEMIES) {
+			// enemy has been spawned in initRoom
+			tile = TILE_EMPTY;
+			commit.enemies++;
+		}
+		tmap[i+NUM_TILES_X] = &tiles[tile * 64];
+	}
+	commit.pos = i;
+	TRACE_ISR_END(TRACE_ROOM_COMMIT);
+}
+
+bool isRoomCommitPending() {
+	return commit.pos < ROOM_SIZE;
+}
+
 void initRoom(uint8_t room) {
+	TRACE_VALUE(room);
+	TRACE_BEGIN(TRACE_ROOM);
+
+	// stop a commit that is still running, the new room overwrites all of its tiles
+	commit.pos = ROOM_SIZE;
+
 	decompressRoom(room);
-	for(uint8_t i = 0; i < NUM_TILES_X*(NUM_TILES_Y-1); i++) {
+	commit.dec = decompressor;
+	commit.state = roomstate[room];
+	commit.bit = 1;
+	commit.enemies = 0;
+
+	initEnemies();
+	for(uint8_t i = 0; i < ROOM_SIZE; i++) {
 		uint8_t tile = decompressByte();
-		tmap[i+NUM_TILES_X] = &tiles[tile * 64];
+		if(isEnemyTile(tile))
+			spawnEnemy(i % NUM_TILES_X, i / NUM_TILES_X + 1, tile);
 	}
-	initEnemies();
+
+	// a room with a full set of enemies is an arena, shown in low resolution so that no enemy shares a sprite
+	setVideoMode(getNumEnemies() == MAX_ENEMIES ? VIDMODE_LOWRES : VIDMODE_TILES_AND_SPRITES);
+
+	// make sure commit state is written before it is handed over to the interrupt
+	__asm__ __volatile__ ("" ::: "memory");
+	commit.pos = 0;
+	addBlankTask(commitRoom, ROOM_COMMIT_CYCLES);
+	TRACE_END(TRACE_ROOM);
 }
 
 uint8_t getAdjacentRoom(uint8_t room, uint8_t adj) {
@@ -108,17 +182,10 @@ void storeRoomState(uint8_t room) {
 	roomstate[room] = state;
 }
 
-void restoreRoomState(uint8_t room) {
-	decompressRoom(room);
-	uint8_t state = roomstate[room];
-	uint8_t bit = 1;
+uint8_t getNumRooms() {
+	return NUM_ROOMS;
+}
 
-	for(uint8_t i = 0; i < NUM_TILES_X*(NUM_TILES_Y-1); i++) {
-		uint8_t tile = decompressByte();
-		if(isCollectible(tile)) {
-			if(state & bit)
-				setTile(i + NUM_TILES_X, TILE_EMPTY);
-			bit <<= 1;
-		}
-	}	
+const uint8_t* getRoomState() {
+	return roomstate;
 }
@@ -24,11 +24,17 @@
 #ifndef ROOM_H
 #define ROOM_H
 
+// room tiles are committed to tmap on blank lines after initRoom returns,
+// removed items are taken from room state and enemies are spawned right away
+// storeRoomState reads tmap, so the room it stores must not have a commit pending
+// initRoom also selects the video mode of the room, see VIDMODE_LOWRES
 void initRoom(uint8_t room);
+bool isRoomCommitPending();
 uint8_t getAdjacentRoom(uint8_t room, uint8_t adj);	// 0 = left, 1 = right, 2 = up, 3 = down
 
 void clearRoomState();
 void storeRoomState(uint8_t room);
-void restoreRoomState(uint8_t room);
+uint8_t getNumRooms();
+const uint8_t* getRoomState();	// one byte per room, a set bit for each item that has been removed
 
 #endif
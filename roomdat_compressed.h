@@ -1,6 +1,6 @@
 const PROGMEM prog_uchar roomadj[] = {
 	0,1,0,4,
-	0,2,-1,5,
+	0,2,0xff,5,
 	1,3,0,6,
 	2,0,0,7,
 	0,5,0,9,
@@ -17,7 +17,8 @@ const PROGMEM prog_uchar roomadj[] = {
 };
 
 const PROGMEM prog_uchar roomNibbleToByte[] = {
-	31,0,16,22,19,27,17,6,29,32,7,25,23,33,13,
+	TILE_WALL_DARK, TILE_EMPTY, TILE_WALL, TILE_KEY, TILE_LADDER, TILE_GOLD, TILE_PRINCESS, TILE_DOOR,
+	TILE_WYVERN, TILE_WYVERN_2ND, TILE_SPIKES, TILE_GHOST_RIGHT, TILE_GHOST_LEFT, TILE_GHOST_LEFT_2ND, TILE_HEART,
 };
 
 const PROGMEM prog_uchar rooms[] = {
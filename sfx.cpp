@@ -27,9 +27,10 @@
 #include "playroutine.h"
 
 #define HZ_TO_FREQ(hz) (65536 * hz / 15735)
-#define CHANNELS		1
+#define SFX_CHANNELS	1		// channels a sound effect may capture, from channel 0 up
+#define SOUND_NONE		0xff
 
-static uint8_t playingSound = -1;
+static uint8_t playingSound = SOUND_NONE;
 static uint8_t soundPhase = 0;
 
 struct Sound {
@@ -51,13 +52,13 @@ void playSound(uint8_t sound) {
 	playingSound = sound;
 	soundPhase = 0;
 
-	for(uint8_t i = 0; i < CHANNELS; i++) {
+	for(uint8_t i = 0; i < SFX_CHANNELS; i++) {
 		if(captureChannels & (1<<i)) {
 			Oscillator* o = &osc[i];
 
 			o->frequency = 0;
 
-			if(sound >= 0) {
+			if(sound != SOUND_NONE) {
 				Sound* s = &sounds[sound];
 				o->waveform = pgm_read_byte_near(&s->waveform);
 				o->pulseWidth = pgm_read_byte_near(&s->pulseWidth);
@@ -71,21 +72,21 @@ void playSound(uint8_t sound) {
 }
 
 void stopSound() {
-	for(uint8_t i = 0; i < CHANNELS; i++)
+	for(uint8_t i = 0; i < SFX_CHANNELS; i++)
 		if(captureChannels & (1<<i))
 			osc[i].frequency = 0;
-	playingSound = -1;
+	playingSound = SOUND_NONE;
 	captureChannels = 0;
 }
 
 void updateSounds() {
-	if(playingSound < 0)
+	if(playingSound == SOUND_NONE)
 		return;
 
 	Sound* s = &sounds[playingSound];
 	soundPhase++;
 
-	for(uint8_t i = 0; i < CHANNELS; i++) {
+	for(uint8_t i = 0; i < SFX_CHANNELS; i++) {
 		if(captureChannels & (1<<i)) {
 			Oscillator* o = &osc[i];
 			switch(playingSound) {
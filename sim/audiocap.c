@@ -0,0 +1,96 @@
+// tqaudiocap: captures the audio output of the simulated firmware
+//
+// Usage: tqaudiocap [-i script] [-n frames] firmware.elf out.wav
+//
+// The video interrupt writes one sample to OCR2A (the PWM duty cycle on pin 11) at the start of every scanline.
+// Every write is logged to an 8 bit WAV at the scanline rate, which host/tqaudio renders too. Compare the two
+// with tools/wavcmp.py.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <simavr/sim_io.h>
+#include "sim.h"
+
+#define OCR2A_ADDR		0xb3		// data space address of OCR2A
+#define SAMPLE_RATE		(SIM_FREQUENCY / SIM_LINE_CYCLES)
+
+static FILE*	wav;
+static uint32_t	samples;
+
+static void writeLE(uint32_t value, int bytes) {
+	for(int i = 0; i < bytes; i++)
+		fputc((value >> (i * 8)) & 0xff, wav);
+}
+
+static void writeHeader() {
+	fwrite("RIFF", 1, 4, wav);
+	writeLE(36 + samples, 4);
+	fwrite("WAVEfmt ", 1, 8, wav);
+	writeLE(16, 4);
+	writeLE(1, 2);				// PCM
+	writeLE(1, 2);				// mono
+	writeLE(SAMPLE_RATE, 4);
+	writeLE(SAMPLE_RATE, 4);	// bytes per second
+	writeLE(1, 2);				// block align
+	writeLE(8, 2);				// bits per sample
+	fwrite("data", 1, 4, wav);
+	writeLE(samples, 4);
+}
+
+static void sampleWritten(struct avr_irq_t* irq, uint32_t value, void* param) {
+	fputc(value, wav);
+	samples++;
+}
+
+int main(int argc, char** argv) {
+	const char* scriptPath = 0;
+	long maxFrames = 600;
+
+	int opt;
+	while((opt = getopt(argc, argv, "i:n:")) != -1) {
+		switch(opt) {
+		case 'i': scriptPath = optarg; break;
+		case 'n': maxFrames = atol(optarg); break;
+		default:
+			fprintf(stderr, "usage: tqaudiocap [-i script] [-n frames] firmware.elf out.wav\n");
+			return 2;
+		}
+	}
+	if(optind != argc - 2) {
+		fprintf(stderr, "usage: tqaudiocap [-i script] [-n frames] firmware.elf out.wav\n");
+		return 2;
+	}
+
+	simInit(argv[optind]);
+	if(scriptPath)
+		simLoadScript(scriptPath);
+
+	wav = fopen(argv[optind + 1], "wb");
+	if(!wav) {
+		perror(argv[optind + 1]);
+		return 1;
+	}
+	writeHeader();
+
+	avr_irq_register_notify(avr_iomem_getirq(avr, OCR2A_ADDR, "ocr2a", AVR_IOMEM_IRQ_ALL), sampleWritten, 0);
+
+	uint32_t frameCounter = simSymbol("frameCounter")->addr;
+	uint8_t lastFrame = simRead8(frameCounter);
+	long frames = 0;
+	while(frames < maxFrames) {
+		if(simStep() == cpu_Done)
+			break;
+		uint8_t frame = simRead8(frameCounter);
+		frames += (uint8_t)(frame - lastFrame);
+		lastFrame = frame;
+	}
+
+	// sizes are known now
+	rewind(wav);
+	writeHeader();
+	fclose(wav);
+
+	printf("%u samples, %ld frames\n", samples, frames);
+	return 0;
+}
@@ -0,0 +1,124 @@
+// tqbudget: measures how long the main loop works after each frame
+//
+// Usage: tqbudget [-i script] [-n frames] [-b lines] [-o frames.csv] firmware.elf
+//
+// waitForVBlank sleeps until the next audio buffer swap, so the CPU goes to sleep for the first time after a swap
+// when loop() has mixed audio and run the game tick for that frame. For every swap the loop woke up at, the tool
+// records the scanline (counted from the swap) at which the CPU went to sleep again. A stretch that runs past
+// the next swap keeps counting, the loop then finds the swap already done and goes straight on.
+//
+// Fails if any stretch is longer than the budget (a frame of 263 lines by default), or if the firmware counted
+// overrunFrames, i.e. a swap went by without audio being mixed for it.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "sim.h"
+
+int main(int argc, char** argv) {
+	const char* scriptPath = 0;
+	const char* csvPath = 0;
+	long maxFrames = 0;
+	int budget = SIM_FRAME_LINES;
+
+	int opt;
+	while((opt = getopt(argc, argv, "i:n:b:o:")) != -1) {
+		switch(opt) {
+		case 'i': scriptPath = optarg; break;
+		case 'n': maxFrames = atol(optarg); break;
+		case 'b': budget = atoi(optarg); break;
+		case 'o': csvPath = optarg; break;
+		default:
+			fprintf(stderr, "usage: tqbudget [-i script] [-n frames] [-b lines] [-o frames.csv] firmware.elf\n");
+			return 2;
+		}
+	}
+	if(optind != argc - 1) {
+		fprintf(stderr, "usage: tqbudget [-i script] [-n frames] [-b lines] [-o frames.csv] firmware.elf\n");
+		return 2;
+	}
+
+	simInit(argv[optind]);
+	if(scriptPath)
+		simLoadScript(scriptPath);
+	if(maxFrames == 0)
+		maxFrames = 600;
+
+	uint32_t scanLine = simSymbol("scanLine")->addr;
+	uint32_t frameCounter = simSymbol("frameCounter")->addr;
+	uint32_t overrunFrames = simSymbol("overrunFrames")->addr;
+
+	FILE* csv = 0;
+	if(csvPath) {
+		csv = fopen(csvPath, "w");
+		if(!csv) {
+			perror(csvPath);
+			return 1;
+		}
+		fprintf(csv, "frame,lines,controller_read\n");
+	}
+
+	long frames = 0;				// swaps since the firmware started
+	uint8_t lastFrame = simRead8(frameCounter);
+	long sleepFrame = -1;			// frames when the CPU last went to sleep
+	int sleeping = 0;
+
+	long stretches = 0;
+	long failures = 0;
+	int worstLines = 0;
+	long worstFrame = 0;
+	uint16_t overruns = simRead16(overrunFrames);
+
+	while(frames < maxFrames) {
+		int state = simStep();
+		if(state == cpu_Done)
+			break;
+
+		uint8_t frame = simRead8(frameCounter);
+		if(frame != lastFrame) {
+			frames += (uint8_t)(frame - lastFrame);
+			lastFrame = frame;
+		}
+
+		// every scanline interrupt wakes the CPU, but waitForVBlank only returns when a swap has happened
+		// since it went to sleep, so the stretch of work started at the first swap after that
+		if(state == cpu_Sleeping && !sleeping) {
+			if(sleepFrame >= 0 && frames != sleepFrame) {
+				long wakeFrame = sleepFrame + 1;
+				int lines = (frames - wakeFrame) * SIM_FRAME_LINES + simRead16(scanLine);
+				if(csv)
+					fprintf(csv, "%ld,%d,%u\n", wakeFrame, lines, controllerReads);
+				stretches++;
+				if(lines > worstLines) {
+					worstLines = lines;
+					worstFrame = wakeFrame;
+				}
+				if(lines > budget) {
+					failures++;
+					fprintf(stderr, "frame %ld: loop went idle %d lines after the swap, budget is %d\n", wakeFrame, lines, budget);
+				}
+			}
+			sleepFrame = frames;
+		}
+		sleeping = (state == cpu_Sleeping);
+
+		uint16_t o = simRead16(overrunFrames);
+		if(o != overruns) {
+			failures++;
+			fprintf(stderr, "frame %ld: firmware counted %u overrun frames\n", frames, (uint16_t)(o - overruns));
+			overruns = o;
+		}
+	}
+
+	if(csv)
+		fclose(csv);
+
+	printf("%ld frames, %ld stretches of work, longest %d lines at frame %ld, budget %d lines\n",
+		frames, stretches, worstLines, worstFrame, budget);
+	if(failures) {
+		printf("FAIL: %ld frames over budget\n", failures);
+		return 1;
+	}
+	printf("OK\n");
+	return 0;
+}
@@ -0,0 +1,289 @@
+// tqprof: sampling profiler with call stacks, split into interrupt and main loop time
+//
+// Usage: tqprof [-i script] [-n frames] [-p cycles] [-o stacks.folded] firmware.elf
+//
+// Samples the program counter every -p cycles (997 by default, prime so that it does not lock to the 1016
+// cycle scanline) for -n frames (600 by default, or to the end of the script with -i). Every sample is
+// attributed to the function containing the PC and, through the return addresses on the stack, to its callers.
+// Prints the functions with the most samples and writes the stacks in the folded format of flamegraph.pl
+// (one "root;caller;callee count" line per stack) with -o.
+//
+// The AVR keeps no frame pointers, so the stack is scanned for return addresses: a byte pair counts as one if
+// the instruction before the address it points to is a call. Saved registers that happen to look like a
+// return address can add a bogus caller now and then.
+//
+// Interrupts are found by the PC entering the vector table. Until the stack pointer is back above the return
+// address pushed by the interrupt, samples go to the "isr" root, the rest to "main". Sleeping in waitForVBlank
+// goes to "idle".
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sim.h"
+
+#define VECTOR_TABLE_END	0x68		// 26 vectors of 4 bytes on the ATmega328P
+#define MAX_DEPTH			32
+#define MAX_NESTING			4
+
+typedef struct {
+	char*		stack;
+	uint32_t	count;
+} FoldedStack;
+
+typedef struct {
+	const char*	name;
+	int			isr;
+	uint32_t	self;
+	uint32_t	total;		// samples with the function anywhere on the stack
+} FunctionStats;
+
+static FoldedStack*		stacks;
+static uint32_t			stackCapacity;		// power of two, open addressing
+static uint32_t			numStacks;
+
+static FunctionStats*	functions;
+static int				numFunctions;
+static int				functionCapacity;
+
+static uint16_t			isrSP[MAX_NESTING];	// stack pointer after the interrupt pushed its return address
+static int				isrDepth;
+
+static uint16_t readSP() {
+	return avr->data[R_SPL] | (avr->data[R_SPH] << 8);
+}
+
+static uint16_t flashWord(uint32_t addr) {
+	return avr->flash[addr] | (avr->flash[addr + 1] << 8);
+}
+
+static int isCallBefore(uint32_t ret) {
+	if(ret >= 2) {
+		uint16_t op = flashWord(ret - 2);
+		if((op & 0xf000) == 0xd000 || op == 0x9509 || op == 0x9519)	// rcall, icall, eicall
+			return 1;
+	}
+	return ret >= 4 && (flashWord(ret - 4) & 0xfe0e) == 0x940e;		// call
+}
+
+// code without a sized symbol (asm labels, the vector table) goes by its address, names are kept for the report
+static const char* functionName(uint32_t addr) {
+	static char* unnamed[256];
+	static int numUnnamed;
+	const SimSymbol* s = simFindCode(addr);
+	if(s)
+		return s->name;
+
+	char name[16];
+	snprintf(name, sizeof(name), "0x%04x", addr);
+	for(int i = 0; i < numUnnamed; i++)
+		if(strcmp(unnamed[i], name) == 0)
+			return unnamed[i];
+	if(numUnnamed == 256)
+		return "unknown";
+	return unnamed[numUnnamed++] = strdup(name);
+}
+
+static FunctionStats* functionStats(const char* name, int isr) {
+	for(int i = 0; i < numFunctions; i++)
+		if(functions[i].isr == isr && strcmp(functions[i].name, name) == 0)
+			return &functions[i];
+	if(numFunctions == functionCapacity) {
+		functionCapacity = functionCapacity ? functionCapacity * 2 : 64;
+		functions = realloc(functions, functionCapacity * sizeof(FunctionStats));
+	}
+	FunctionStats* f = &functions[numFunctions++];
+	f->name = name;
+	f->isr = isr;
+	f->self = 0;
+	f->total = 0;
+	return f;
+}
+
+static uint32_t hashString(const char* s) {
+	uint32_t h = 0x811c9dc5;
+	while(*s)
+		h = (h ^ (uint8_t)*s++) * 0x01000193;
+	return h;
+}
+
+static void addStack(const char* stack) {
+	if(numStacks * 2 >= stackCapacity) {
+		uint32_t oldCapacity = stackCapacity;
+		FoldedStack* old = stacks;
+		stackCapacity = stackCapacity ? stackCapacity * 2 : 1024;
+		stacks = calloc(stackCapacity, sizeof(FoldedStack));
+		numStacks = 0;
+		for(uint32_t i = 0; i < oldCapacity; i++) {
+			if(old[i].stack) {
+				uint32_t j = hashString(old[i].stack) & (stackCapacity - 1);
+				while(stacks[j].stack)
+					j = (j + 1) & (stackCapacity - 1);
+				stacks[j] = old[i];
+				numStacks++;
+			}
+		}
+		free(old);
+	}
+
+	uint32_t i = hashString(stack) & (stackCapacity - 1);
+	while(stacks[i].stack && strcmp(stacks[i].stack, stack) != 0)
+		i = (i + 1) & (stackCapacity - 1);
+	if(!stacks[i].stack) {
+		stacks[i].stack = strdup(stack);
+		numStacks++;
+	}
+	stacks[i].count++;
+}
+
+// callers from the return addresses between the stack pointer and 'top', innermost first
+static int walkStack(uint16_t top, const char** frames, int depth) {
+	for(uint32_t i = readSP() + 1; i + 1 <= top && depth < MAX_DEPTH; ) {
+		// call pushes the low byte first, so the high byte ends up at the lower address
+		uint32_t ret = ((avr->data[i] << 8) | avr->data[i + 1]) * 2;
+		if(ret <= avr->flashend && isCallBefore(ret)) {
+			frames[depth++] = functionName(ret - 2);
+			i += 2;
+		} else {
+			i++;
+		}
+	}
+	return depth;
+}
+
+static void takeSample(int sleeping) {
+	const char* frames[MAX_DEPTH];
+	int depth = 0;
+	int isr = isrDepth > 0;
+	const char* root;
+
+	if(sleeping && !isr) {
+		root = "idle";
+	} else {
+		root = isr ? "isr" : "main";
+		frames[depth++] = functionName(avr->pc);
+		depth = walkStack(isr ? isrSP[isrDepth - 1] : avr->ramend, frames, depth);
+	}
+
+	// folded stacks are written from the root down
+	char line[MAX_DEPTH * 64];
+	int len = snprintf(line, sizeof(line), "%s", root);
+	for(int i = depth - 1; i >= 0 && len < (int)sizeof(line); i--)
+		len += snprintf(line + len, sizeof(line) - len, ";%s", frames[i]);
+	addStack(line);
+
+	if(depth == 0) {
+		functionStats(root, 0)->self++;
+		functionStats(root, 0)->total++;
+		return;
+	}
+	functionStats(frames[0], isr)->self++;
+	for(int i = 0; i < depth; i++) {
+		// recursion or a bogus frame can repeat a function, count it once
+		int seen = 0;
+		for(int j = 0; j < i; j++)
+			if(strcmp(frames[j], frames[i]) == 0)
+				seen = 1;
+		if(!seen)
+			functionStats(frames[i], isr)->total++;
+	}
+}
+
+static int compareSelf(const void* a, const void* b) {
+	const FunctionStats* fa = a;
+	const FunctionStats* fb = b;
+	return fb->self > fa->self ? 1 : fb->self < fa->self ? -1 : 0;
+}
+
+int main(int argc, char** argv) {
+	const char* scriptPath = 0;
+	const char* foldedPath = 0;
+	long maxFrames = 0;
+	uint32_t period = 997;
+
+	int opt;
+	while((opt = getopt(argc, argv, "i:n:p:o:")) != -1) {
+		switch(opt) {
+		case 'i': scriptPath = optarg; break;
+		case 'n': maxFrames = atol(optarg); break;
+		case 'p': period = atol(optarg); break;
+		case 'o': foldedPath = optarg; break;
+		default:
+			fprintf(stderr, "usage: tqprof [-i script] [-n frames] [-p cycles] [-o stacks.folded] firmware.elf\n");
+			return 2;
+		}
+	}
+	if(optind != argc - 1 || period == 0) {
+		fprintf(stderr, "usage: tqprof [-i script] [-n frames] [-p cycles] [-o stacks.folded] firmware.elf\n");
+		return 2;
+	}
+
+	simInit(argv[optind]);
+	uint32_t scriptEnd = 0;
+	if(scriptPath) {
+		simLoadScript(scriptPath);
+		scriptEnd = simScriptLength();
+	}
+	if(maxFrames == 0 && scriptEnd == 0)
+		maxFrames = 600;
+
+	uint32_t frameCounter = simSymbol("frameCounter")->addr;
+	uint8_t lastFrame = simRead8(frameCounter);
+	long frames = 0;
+	uint64_t nextSample = period;
+	uint32_t samples = 0;
+	uint32_t rootSamples[3] = { 0, 0, 0 };	// main, isr, idle
+
+	while(maxFrames ? frames < maxFrames : controllerReads < scriptEnd) {
+		int state = simStep();
+		if(state == cpu_Done)
+			break;
+
+		uint16_t sp = readSP();
+		while(isrDepth > 0 && sp > isrSP[isrDepth - 1])
+			isrDepth--;
+		if(avr->pc > 0 && avr->pc < VECTOR_TABLE_END && isrDepth < MAX_NESTING)
+			isrSP[isrDepth++] = sp;
+
+		// a sleep step can cover many sample points, they all see the cpu asleep
+		while(avr->cycle >= nextSample) {
+			int sleeping = (state == cpu_Sleeping);
+			takeSample(sleeping);
+			rootSamples[sleeping && !isrDepth ? 2 : isrDepth ? 1 : 0]++;
+			samples++;
+			nextSample += period;
+		}
+
+		uint8_t frame = simRead8(frameCounter);
+		frames += (uint8_t)(frame - lastFrame);
+		lastFrame = frame;
+	}
+
+	if(foldedPath) {
+		FILE* f = fopen(foldedPath, "w");
+		if(!f) {
+			perror(foldedPath);
+			return 1;
+		}
+		for(uint32_t i = 0; i < stackCapacity; i++)
+			if(stacks[i].stack)
+				fprintf(f, "%s %u\n", stacks[i].stack, stacks[i].count);
+		fclose(f);
+	}
+
+	if(samples == 0) {
+		printf("no samples\n");
+		return 1;
+	}
+	printf("%ld frames, %u samples every %u cycles: main %.1f%%, isr %.1f%%, idle %.1f%%\n", frames, samples, period,
+		100.0 * rootSamples[0] / samples, 100.0 * rootSamples[1] / samples, 100.0 * rootSamples[2] / samples);
+
+	qsort(functions, numFunctions, sizeof(FunctionStats), compareSelf);
+	printf("%7s %7s %8s %s\n", "self%", "total%", "cyc/frm", "function");
+	for(int i = 0; i < numFunctions && i < 40; i++) {
+		const FunctionStats* f = &functions[i];
+		printf("%6.2f%% %6.2f%% %8.0f %s%s\n", 100.0 * f->self / samples, 100.0 * f->total / samples,
+			frames ? (double)f->self * period / frames : 0.0, f->isr ? "[isr] " : "", f->name);
+	}
+	return 0;
+}
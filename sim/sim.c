@@ -0,0 +1,275 @@
+// Toorum's Quest II simulator harness, see sim.h
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <simavr/sim_avr.h>
+#include <simavr/sim_elf.h>
+#include <simavr/avr_ioport.h>
+#include "sim.h"
+
+// gamepad.cpp pins: latch = 12, clock = 10, data = 13
+#define PAD_PORT		'B'
+#define PAD_LATCH		4
+#define PAD_CLOCK		2
+#define PAD_DATA		5
+
+#define DATA_OFFSET		0x800000	// avr-nm address of data space address 0
+
+avr_t*		avr;
+uint32_t	controllerReads;
+void		(*simReadHook)(uint32_t read);
+
+static elf_firmware_t	firmware;
+static SimSymbol*		symbols;
+static int				numSymbols;
+
+typedef struct {
+	uint32_t	read;
+	uint8_t		buttons;
+} ScriptLine;
+
+static ScriptLine*		script;
+static int				scriptLines;
+static uint32_t			scriptEnd;		// reads in a recording, read of the last line in a script
+
+static avr_irq_t*		padData;
+static uint8_t			padShift;		// buttons still to be shifted out, pressed = 1
+static uint8_t			padLatch;
+static uint8_t			padClock;
+
+static void loadSymbols(const char* elfPath) {
+	const char* nm = getenv("AVR_NM");
+	char cmd[1024];
+	snprintf(cmd, sizeof(cmd), "%s -S -C '%s'", nm ? nm : "avr-nm", elfPath);
+
+	FILE* f = popen(cmd, "r");
+	if(!f) {
+		perror(cmd);
+		exit(1);
+	}
+
+	char line[1024];
+	int capacity = 0;
+	while(fgets(line, sizeof(line), f)) {
+		// address [size] type name, demangled names can contain spaces
+		line[strcspn(line, "\n")] = 0;
+		char* p = line;
+		unsigned long addr = strtoul(p, &p, 16);
+		unsigned long size = 0;
+		char* q;
+		unsigned long field = strtoul(p, &q, 16);
+		if(q != p && q[0] == ' ' && q[1] && q[2] == ' ') {
+			size = field;
+			p = q;
+		}
+		if(p[0] != ' ' || !p[1] || p[2] != ' ')
+			continue;
+		char type = p[1];
+		int n = p + 3 - line;
+
+		if(numSymbols == capacity) {
+			capacity = capacity ? capacity * 2 : 256;
+			symbols = realloc(symbols, capacity * sizeof(SimSymbol));
+		}
+		SimSymbol* s = &symbols[numSymbols++];
+		s->name = strdup(line + n);
+		s->addr = (addr >= DATA_OFFSET ? addr - DATA_OFFSET : addr);
+		s->size = size;
+		s->type = type;
+	}
+
+	if(pclose(f) != 0 || numSymbols == 0) {
+		fprintf(stderr, "%s: could not read symbols\n", elfPath);
+		exit(1);
+	}
+}
+
+static void updatePadData() {
+	// buttons are active low
+	avr_raise_irq(padData, (padShift & 0x80) ? 0 : 1);
+}
+
+static void padLatchChanged(struct avr_irq_t* irq, uint32_t value, void* param) {
+	// 4021 shift register loads the buttons while latch is high
+	if(value && !padLatch) {
+		if(simReadHook)
+			simReadHook(controllerReads);
+		padShift = simScriptButtons(controllerReads++);
+		updatePadData();
+	}
+	padLatch = value;
+}
+
+static void padClockChanged(struct avr_irq_t* irq, uint32_t value, void* param) {
+	if(value && !padClock && !padLatch) {
+		padShift <<= 1;
+		updatePadData();
+	}
+	padClock = value;
+}
+
+void simInit(const char* elfPath) {
+	if(elf_read_firmware(elfPath, &firmware) != 0) {
+		fprintf(stderr, "%s: could not load firmware\n", elfPath);
+		exit(1);
+	}
+	firmware.frequency = SIM_FREQUENCY;
+
+	avr = avr_make_mcu_by_name("atmega328p");
+	if(!avr) {
+		fprintf(stderr, "simavr does not support atmega328p\n");
+		exit(1);
+	}
+	avr_init(avr);
+	avr_load_firmware(avr, &firmware);
+
+	loadSymbols(elfPath);
+
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(PAD_PORT), PAD_LATCH), padLatchChanged, 0);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(PAD_PORT), PAD_CLOCK), padClockChanged, 0);
+	padData = avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(PAD_PORT), PAD_DATA);
+	updatePadData();
+}
+
+int simStep() {
+	int state = avr_run(avr);
+	if(state == cpu_Crashed) {
+		fprintf(stderr, "firmware crashed at pc 0x%04x, cycle %llu\n", avr->pc, (unsigned long long)avr->cycle);
+		exit(1);
+	}
+	return state;
+}
+
+const SimSymbol* simSymbol(const char* name) {
+	for(int i = 0; i < numSymbols; i++)
+		if(strcmp(symbols[i].name, name) == 0)
+			return &symbols[i];
+	fprintf(stderr, "firmware has no symbol %s\n", name);
+	exit(1);
+}
+
+const SimSymbol* simFindCode(uint32_t addr) {
+	for(int i = 0; i < numSymbols; i++) {
+		const SimSymbol* s = &symbols[i];
+		if(strchr("tTwW", s->type) && addr >= s->addr && addr < s->addr + s->size)
+			return s;
+	}
+	return 0;
+}
+
+int simParseButtons(const char* text) {
+	static const char* names[8] = { "RIGHT", "LEFT", "DOWN", "UP", "START", "SELECT", "B", "A" };
+	int buttons = 0;
+	while(*text) {
+		while(isspace((unsigned char)*text))
+			text++;
+		int len = 0;
+		while(text[len] && !isspace((unsigned char)text[len]))
+			len++;
+		if(len == 0)
+			break;
+
+		int i;
+		for(i = 0; i < 8; i++)
+			if((int)strlen(names[i]) == len && strncmp(text, names[i], len) == 0)
+				break;
+		if(i == 8)
+			return -1;
+		buttons |= 1 << i;
+		text += len;
+	}
+	return buttons;
+}
+
+static void addScriptLine(uint32_t read, uint8_t buttons) {
+	script = realloc(script, (scriptLines + 1) * sizeof(ScriptLine));
+	script[scriptLines].read = read;
+	script[scriptLines].buttons = buttons;
+	scriptLines++;
+}
+
+static uint32_t readLE32(const uint8_t* p) {
+	return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+// .tqr recording, see tools/inputrec.py, the runs become script lines
+static void loadRecording(const char* path, FILE* f) {
+	uint8_t header[16];
+	if(fread(header, 1, sizeof(header), f) != sizeof(header)) {
+		fprintf(stderr, "%s: recording is too short\n", path);
+		exit(1);
+	}
+	if(header[8] != 0) {
+		fprintf(stderr, "%s: recording does not start at power up\n", path);
+		exit(1);
+	}
+	uint32_t reads = readLE32(header + 12);
+
+	uint32_t read = 0;
+	while(read < reads) {
+		int count = fgetc(f);
+		int buttons = fgetc(f);
+		if(buttons == EOF || count == 0) {
+			fprintf(stderr, "%s: recording is damaged after %u of %u reads\n", path, read, reads);
+			exit(1);
+		}
+		if(scriptLines == 0 || script[scriptLines - 1].buttons != buttons)
+			addScriptLine(read, buttons);
+		read += count;
+	}
+	scriptEnd = reads;
+}
+
+void simLoadScript(const char* path) {
+	FILE* f = fopen(path, "rb");
+	if(!f) {
+		perror(path);
+		exit(1);
+	}
+
+	char magic[4];
+	if(fread(magic, 1, 4, f) == 4 && memcmp(magic, "TQR1", 4) == 0) {
+		rewind(f);
+		loadRecording(path, f);
+		fclose(f);
+		return;
+	}
+	rewind(f);
+
+	char line[256];
+	int n = 0;
+	while(fgets(line, sizeof(line), f)) {
+		n++;
+		line[strcspn(line, "#\n")] = 0;
+		char* p = line;
+		while(isspace((unsigned char)*p))
+			p++;
+		if(*p == 0)
+			continue;
+
+		char* end;
+		unsigned long read = strtoul(p, &end, 10);
+		int buttons = simParseButtons(end);
+		if(end == p || buttons < 0 || (scriptLines > 0 && read <= script[scriptLines - 1].read)) {
+			fprintf(stderr, "%s:%d: expected increasing read number and buttons\n", path, n);
+			exit(1);
+		}
+
+		addScriptLine(read, buttons);
+		scriptEnd = read;
+	}
+	fclose(f);
+}
+
+uint8_t simScriptButtons(uint32_t read) {
+	uint8_t buttons = 0;
+	for(int i = 0; i < scriptLines && script[i].read <= read; i++)
+		buttons = script[i].buttons;
+	return buttons;
+}
+
+uint32_t simScriptLength() {
+	return scriptEnd;
+}
@@ -0,0 +1,66 @@
+// Toorum's Quest II simulator harness, shared by the tools in this directory
+//
+// Runs the unmodified firmware ELF in simavr on an ATmega328P at 16 MHz, emulates the NES controller on
+// the gamepad pins and looks up the firmware's globals from its symbols (read with avr-nm, set AVR_NM to
+// use another nm). See README.md for building and the input script format.
+
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <simavr/sim_avr.h>
+
+#define SIM_FREQUENCY		16000000
+#define SIM_LINE_CYCLES		1016		// ICR1 + 1
+#define SIM_FRAME_LINES		263			// scanLine runs from 0 to LINES_PER_FRAME
+
+// gamepad.h
+#define BUTTON_A			(1<<7)
+#define BUTTON_B			(1<<6)
+#define BUTTON_SELECT		(1<<5)
+#define BUTTON_START		(1<<4)
+#define BUTTON_UP			(1<<3)
+#define BUTTON_DOWN			(1<<2)
+#define BUTTON_LEFT			(1<<1)
+#define BUTTON_RIGHT		(1<<0)
+
+typedef struct {
+	const char*	name;
+	uint32_t	addr;		// data space address for variables, byte address for code
+	uint32_t	size;
+	char		type;		// avr-nm symbol type
+} SimSymbol;
+
+extern avr_t*		avr;
+extern uint32_t		controllerReads;	// latch pulses seen, the firmware reads the controller once per pulse
+extern void			(*simReadHook)(uint32_t read);	// called on each latch pulse before the buttons are loaded, 0 for none
+
+// loads the firmware and its symbols, exits on failure
+void simInit(const char* elfPath);
+
+// runs one instruction (or one sleep period), returns the simavr cpu state
+int simStep();
+
+// symbol of the given name, exits if there is none
+const SimSymbol* simSymbol(const char* name);
+
+// symbol containing the code address, or 0
+const SimSymbol* simFindCode(uint32_t addr);
+
+static inline uint8_t simRead8(uint32_t addr) {
+	return avr->data[addr];
+}
+
+static inline uint16_t simRead16(uint32_t addr) {
+	return avr->data[addr] | (avr->data[addr + 1] << 8);
+}
+
+// controller input, the buttons held on each read come from a script or a .tqr recording (see README.md)
+void simLoadScript(const char* path);
+uint8_t simScriptButtons(uint32_t read);
+uint32_t simScriptLength();		// reads in a recording, read of the last line in a script
+
+// parses a button list like "A RIGHT", returns -1 on an unknown name
+int simParseButtons(const char* text);
+
+#endif
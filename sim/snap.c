@@ -0,0 +1,144 @@
+// tqsnap: writes a game state snapshot at every controller read, see snapshot.h
+//
+// Usage: tqsnap [-i script] [-n reads] firmware.elf out.snap
+//
+// Runs until the given number of reads, by default to the end of the script or recording. The snapshots are
+// compared with the ones of host/tqreplay -s by tools/lockstep.py.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "sim.h"
+#include "snapshot.h"
+
+static FILE*		out;
+static uint32_t		recordSize;
+static uint32_t		frames;
+
+static uint32_t		player, numEnemies, enemies, tmap, roomstate, roomstateSize;
+static uint32_t		tiles, font, updateWyvern, updateGhost;
+
+static void put16(uint8_t* p, uint16_t v) {
+	p[0] = v;
+	p[1] = v >> 8;
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+	put16(p, v);
+	put16(p + 2, v >> 16);
+}
+
+// tmap entries point to flash, the array they point into is the closest one below
+static uint16_t tileIndex(uint16_t ptr) {
+	if(ptr >= tiles && (ptr < font || font < tiles))
+		return (ptr - tiles) / 64;
+	if(ptr >= font)
+		return SNAP_GLYPH + (ptr - font) / 8;
+	return SNAP_OTHER;
+}
+
+static uint8_t funcIndex(uint16_t func) {
+	// function pointers are word addresses
+	if(func == 0)
+		return SNAP_FUNC_NONE;
+	if(func * 2 == updateWyvern)
+		return SNAP_FUNC_WYVERN;
+	if(func * 2 == updateGhost)
+		return SNAP_FUNC_GHOST;
+	return SNAP_FUNC_OTHER;
+}
+
+static void writeSnapshot(uint32_t read) {
+	uint8_t rec[1024];
+	put32(rec + SNAP_READ, read);
+	put32(rec + SNAP_FRAME, frames);
+	memcpy(rec + SNAP_PLAYER, avr->data + player, SNAP_PLAYER_SIZE);
+	rec[SNAP_NUM_ENEMIES] = simRead8(numEnemies);
+	for(int i = 0; i < SNAP_MAX_ENEMIES; i++) {
+		uint32_t e = enemies + i * (SNAP_ENEMY_SIZE + 1);
+		uint8_t* r = rec + SNAP_ENEMIES + i * SNAP_ENEMY_SIZE;
+		memcpy(r, avr->data + e, SNAP_ENEMY_SIZE - 1);
+		r[SNAP_ENEMY_SIZE - 1] = funcIndex(simRead16(e + SNAP_ENEMY_SIZE - 1));
+	}
+	for(int i = 0; i < SNAP_TMAP_SIZE; i++)
+		put16(rec + SNAP_TMAP + i * 2, tileIndex(simRead16(tmap + i * 2)));
+	memcpy(rec + SNAP_ROOMSTATE, avr->data + roomstate, roomstateSize);
+	fwrite(rec, 1, recordSize, out);
+}
+
+static uint32_t checkedSymbol(const char* name, uint32_t size) {
+	const SimSymbol* s = simSymbol(name);
+	if(size && s->size != size) {
+		fprintf(stderr, "%s is %u bytes, snapshot.h expects %u\n", name, s->size, size);
+		exit(1);
+	}
+	return s->addr;
+}
+
+int main(int argc, char** argv) {
+	const char* scriptPath = 0;
+	uint32_t maxReads = 0;
+
+	int opt;
+	while((opt = getopt(argc, argv, "i:n:")) != -1) {
+		switch(opt) {
+		case 'i': scriptPath = optarg; break;
+		case 'n': maxReads = atol(optarg); break;
+		default:
+			fprintf(stderr, "usage: tqsnap [-i script] [-n reads] firmware.elf out.snap\n");
+			return 2;
+		}
+	}
+	if(optind != argc - 2) {
+		fprintf(stderr, "usage: tqsnap [-i script] [-n reads] firmware.elf out.snap\n");
+		return 2;
+	}
+
+	simInit(argv[optind]);
+	if(scriptPath)
+		simLoadScript(scriptPath);
+	if(maxReads == 0)
+		maxReads = simScriptLength();
+	if(maxReads == 0) {
+		fprintf(stderr, "tqsnap: give the number of reads with -n\n");
+		return 2;
+	}
+
+	player = checkedSymbol("p", SNAP_PLAYER_SIZE);
+	numEnemies = checkedSymbol("numEnemies", 1);
+	enemies = checkedSymbol("enemies", SNAP_MAX_ENEMIES * (SNAP_ENEMY_SIZE + 1));
+	tmap = checkedSymbol("tmap", SNAP_TMAP_SIZE * 2);
+	roomstate = checkedSymbol("roomstate", 0);
+	roomstateSize = simSymbol("roomstate")->size;
+	tiles = checkedSymbol("tiles", 0);
+	font = checkedSymbol("font", 0);
+	updateWyvern = checkedSymbol("updateWyvern(Enemy*)", 0);
+	updateGhost = checkedSymbol("updateGhost(Enemy*)", 0);
+	recordSize = SNAP_ROOMSTATE + roomstateSize;
+
+	out = fopen(argv[optind + 1], "wb");
+	if(!out) {
+		perror(argv[optind + 1]);
+		return 1;
+	}
+	uint8_t header[6];
+	memcpy(header, SNAP_MAGIC, 4);
+	put16(header + 4, recordSize);
+	fwrite(header, 1, sizeof(header), out);
+	simReadHook = writeSnapshot;
+
+	uint32_t frameCounter = simSymbol("frameCounter")->addr;
+	uint8_t lastFrame = simRead8(frameCounter);
+	while(controllerReads < maxReads) {
+		if(simStep() == cpu_Done)
+			break;
+		uint8_t frame = simRead8(frameCounter);
+		frames += (uint8_t)(frame - lastFrame);
+		lastFrame = frame;
+	}
+
+	fclose(out);
+	printf("%u snapshots, %u frames\n", controllerReads, frames);
+	return 0;
+}
@@ -0,0 +1,34 @@
+// Game state snapshots for lockstep testing, shared by sim/tqsnap and host/tqreplay, see tools/lockstep.py
+//
+// A snapshot is taken at every controller read, before the buttons are read. The game only changes its state in
+// game ticks, which start with the read, so the host build and the firmware must agree on every snapshot even
+// when the firmware drops a frame. Records hold the state in the AVR layout, packed and little endian.
+//
+// File: SNAP_MAGIC, uint16 record size, then one record per read.
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#define SNAP_MAGIC			"TQS1"
+
+#define SNAP_READ			0		// uint32 controller read
+#define SNAP_FRAME			4		// uint32 frames since power up, only for the report
+#define SNAP_PLAYER			8		// Player p
+#define SNAP_PLAYER_SIZE	17
+#define SNAP_NUM_ENEMIES	25		// uint8 numEnemies
+#define SNAP_ENEMIES		26		// MAX_ENEMIES enemies
+#define SNAP_ENEMY_SIZE		8		// Enemy up to updateFunc, then updateFunc as SNAP_FUNC_*
+#define SNAP_MAX_ENEMIES	4
+#define SNAP_TMAP			58		// NUM_TILES_X*NUM_TILES_Y uint16, tile index, SNAP_GLYPH + glyph or SNAP_OTHER
+#define SNAP_TMAP_SIZE		130
+#define SNAP_ROOMSTATE		318		// roomstate, to the end of the record
+
+#define SNAP_FUNC_NONE		0
+#define SNAP_FUNC_WYVERN	1
+#define SNAP_FUNC_GHOST		2
+#define SNAP_FUNC_OTHER		0xff
+
+#define SNAP_GLYPH			0x100
+#define SNAP_OTHER			0xffff
+
+#endif
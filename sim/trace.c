@@ -0,0 +1,100 @@
+// tqtrace: timestamps the trace markers of a DEBUG_TRACE build, see ../trace.h
+//
+// Usage: tqtrace [-i script] [-n frames] firmware.elf out.csv
+//
+// Logs every write to GPIOR0 (main loop) and GPIOR1 (video interrupt) with its cycle, frame and scanline, for
+// 600 frames (or -n), or to the end of the script with -i. tools/traceview.py turns the log into per-event
+// latency distributions and a timeline.
+//
+// CSV columns: cycle, frame, line, source (main or isr), event id, phase (B or E), value of GPIOR2 for begins.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <simavr/sim_io.h>
+#include "sim.h"
+
+#define GPIOR0_ADDR		0x3e	// data space addresses
+#define GPIOR1_ADDR		0x4a
+#define GPIOR2_ADDR		0x4b
+#define TRACE_END_BIT	0x80
+
+static FILE*		out;
+static uint32_t	scanLine;
+static uint32_t	frameCounter;
+static uint8_t		lastFrame;
+static long		frames;
+static long		events;
+
+static void updateFrames() {
+	uint8_t frame = simRead8(frameCounter);
+	frames += (uint8_t)(frame - lastFrame);
+	lastFrame = frame;
+}
+
+static void markerWritten(struct avr_irq_t* irq, uint32_t value, void* param) {
+	updateFrames();
+	int end = (value & TRACE_END_BIT) != 0;
+	fprintf(out, "%llu,%ld,%u,%s,%u,%c,", (unsigned long long)avr->cycle, frames, simRead16(scanLine),
+		(const char*)param, value & ~TRACE_END_BIT, end ? 'E' : 'B');
+	if(!end)
+		fprintf(out, "%u", avr->data[GPIOR2_ADDR]);
+	fputc('\n', out);
+	events++;
+}
+
+int main(int argc, char** argv) {
+	const char* scriptPath = 0;
+	long maxFrames = 0;
+
+	int opt;
+	while((opt = getopt(argc, argv, "i:n:")) != -1) {
+		switch(opt) {
+		case 'i': scriptPath = optarg; break;
+		case 'n': maxFrames = atol(optarg); break;
+		default:
+			fprintf(stderr, "usage: tqtrace [-i script] [-n frames] firmware.elf out.csv\n");
+			return 2;
+		}
+	}
+	if(optind != argc - 2) {
+		fprintf(stderr, "usage: tqtrace [-i script] [-n frames] firmware.elf out.csv\n");
+		return 2;
+	}
+
+	simInit(argv[optind]);
+	uint32_t scriptEnd = 0;
+	if(scriptPath) {
+		simLoadScript(scriptPath);
+		scriptEnd = simScriptLength();
+	}
+	if(maxFrames == 0 && scriptEnd == 0)
+		maxFrames = 600;
+
+	out = fopen(argv[optind + 1], "w");
+	if(!out) {
+		perror(argv[optind + 1]);
+		return 1;
+	}
+	fprintf(out, "cycle,frame,line,source,event,phase,value\n");
+
+	scanLine = simSymbol("scanLine")->addr;
+	frameCounter = simSymbol("frameCounter")->addr;
+	lastFrame = simRead8(frameCounter);
+	avr_irq_register_notify(avr_iomem_getirq(avr, GPIOR0_ADDR, "gpior0", AVR_IOMEM_IRQ_ALL), markerWritten, "main");
+	avr_irq_register_notify(avr_iomem_getirq(avr, GPIOR1_ADDR, "gpior1", AVR_IOMEM_IRQ_ALL), markerWritten, "isr");
+
+	while(maxFrames ? frames < maxFrames : controllerReads < scriptEnd) {
+		if(simStep() == cpu_Done)
+			break;
+		updateFrames();
+	}
+
+	fclose(out);
+	printf("%ld frames, %ld markers\n", frames, events);
+	if(events == 0) {
+		fprintf(stderr, "no markers, was the firmware built with DEBUG_TRACE?\n");
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,216 @@
+// tqtv: reconstructs the video output of the simulated firmware
+//
+// Usage: tqtv [-i script] [-n frames] [-s first] [-c cadence] [-d dir] [-o lines.csv] firmware.elf
+//
+// Every write to PORT_VID (PORTD) is timestamped and every falling edge of SYNC_PIN (OC1A) starts a scanline,
+// a sync pulse longer than half a line marks the vertical sync and starts a new frame at line 0. Frames from
+// -s on are rendered to PPM images with one pixel per cadence cycles across the whole scanline, so the
+// blanking is visible too. The video port byte is read as RGB332.
+//
+// For every line with pixels the tool reports the cycle of the first write after the start of the line and
+// the intervals between writes that differ from the cadence. The first write should be on the same cycle
+// on every line of a region, anything else shows up as a wobbly picture on a TV.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <simavr/sim_io.h>
+#include <simavr/avr_ioport.h>
+#include "sim.h"
+
+#define PORTD_ADDR		0x2b		// data space address of PORTD
+#define SYNC_PORT		'B'
+#define SYNC_PIN		1
+
+#define MAX_WRITES		1024
+#define MAX_OFFSET		SIM_LINE_CYCLES
+#define MIN_PIXELS		16			// lines with fewer writes are not analyzed
+
+typedef struct {
+	uint32_t	offset;		// cycles from the start of the line
+	uint8_t		value;
+} PortWrite;
+
+static int			cadence = 6;
+static int			width;
+static const char*	imageDir = 0;
+static long			firstFrame = 0;
+static FILE*		csv;
+
+static PortWrite	writes[MAX_WRITES];
+static int			numWrites;
+static uint8_t		lineColor;			// port value when the line started
+static uint8_t		portValue;
+static uint64_t		lineStart;
+static int			lineActive;			// a falling sync edge has been seen
+static int			inVsync;
+
+static long			frame = -1;			// -1 until the first vertical sync
+static int			line;
+static uint8_t*		image;
+
+static long			linesAnalyzed;
+static long			offCadence;
+static long			firstWriteCount[MAX_OFFSET];
+
+static void saveImage() {
+	if(!imageDir || frame < firstFrame)
+		return;
+
+	char path[1024];
+	snprintf(path, sizeof(path), "%s/frame%04ld.ppm", imageDir, frame);
+	FILE* f = fopen(path, "wb");
+	if(!f) {
+		perror(path);
+		exit(1);
+	}
+	fprintf(f, "P6\n%d %d\n255\n", width, SIM_FRAME_LINES);
+	fwrite(image, 3, width * SIM_FRAME_LINES, f);
+	fclose(f);
+}
+
+static void renderLine() {
+	if(line >= SIM_FRAME_LINES)
+		return;
+
+	uint8_t* dst = image + line * width * 3;
+	uint8_t color = lineColor;
+	int w = 0;
+	for(int x = 0; x < width; x++) {
+		uint32_t t = x * cadence + cadence / 2;
+		while(w < numWrites && writes[w].offset <= t)
+			color = writes[w++].value;
+		dst[0] = ((color >> 5) & 7) * 255 / 7;
+		dst[1] = ((color >> 2) & 7) * 255 / 7;
+		dst[2] = (color & 3) * 255 / 3;
+		dst += 3;
+	}
+}
+
+static void analyzeLine() {
+	if(numWrites < MIN_PIXELS || frame < firstFrame)
+		return;
+
+	int off = 0;
+	int maxDeviation = 0;
+	for(int i = 1; i < numWrites; i++) {
+		int d = (int)(writes[i].offset - writes[i - 1].offset) - cadence;
+		if(d != 0) {
+			off++;
+			if(abs(d) > abs(maxDeviation))
+				maxDeviation = d;
+		}
+	}
+
+	linesAnalyzed++;
+	offCadence += off;
+	if(writes[0].offset < MAX_OFFSET)
+		firstWriteCount[writes[0].offset]++;
+	if(csv)
+		fprintf(csv, "%ld,%d,%u,%d,%d,%d\n", frame, line, writes[0].offset, numWrites, off, maxDeviation);
+}
+
+static void endLine() {
+	if(frame >= 0) {
+		renderLine();
+		analyzeLine();
+	}
+	line++;
+}
+
+static void portWritten(struct avr_irq_t* irq, uint32_t value, void* param) {
+	portValue = value;
+	if(lineActive && numWrites < MAX_WRITES) {
+		writes[numWrites].offset = avr->cycle - lineStart;
+		writes[numWrites].value = value;
+		numWrites++;
+	}
+}
+
+static void syncChanged(struct avr_irq_t* irq, uint32_t value, void* param) {
+	if(!value) {
+		// falling edge, start of a scanline
+		if(lineActive)
+			endLine();
+		lineActive = 1;
+		lineStart = avr->cycle;
+		lineColor = portValue;
+		numWrites = 0;
+	} else if(lineActive) {
+		int vsync = (avr->cycle - lineStart > SIM_LINE_CYCLES / 2);
+		if(vsync && !inVsync) {
+			// first line of the vertical sync, the current line becomes line 0 of the next frame
+			if(frame >= 0)
+				saveImage();
+			frame++;
+			line = 0;
+			memset(image, 0, width * SIM_FRAME_LINES * 3);
+		}
+		inVsync = vsync;
+	}
+}
+
+int main(int argc, char** argv) {
+	const char* scriptPath = 0;
+	const char* csvPath = 0;
+	long maxFrames = 3;
+
+	int opt;
+	while((opt = getopt(argc, argv, "i:n:s:c:d:o:")) != -1) {
+		switch(opt) {
+		case 'i': scriptPath = optarg; break;
+		case 'n': maxFrames = atol(optarg); break;
+		case 's': firstFrame = atol(optarg); break;
+		case 'c': cadence = atoi(optarg); break;
+		case 'd': imageDir = optarg; break;
+		case 'o': csvPath = optarg; break;
+		default:
+			fprintf(stderr, "usage: tqtv [-i script] [-n frames] [-s first] [-c cadence] [-d dir] [-o lines.csv] firmware.elf\n");
+			return 2;
+		}
+	}
+	if(optind != argc - 1 || cadence < 1) {
+		fprintf(stderr, "usage: tqtv [-i script] [-n frames] [-s first] [-c cadence] [-d dir] [-o lines.csv] firmware.elf\n");
+		return 2;
+	}
+
+	simInit(argv[optind]);
+	if(scriptPath)
+		simLoadScript(scriptPath);
+
+	width = SIM_LINE_CYCLES / cadence;
+	image = calloc(width * SIM_FRAME_LINES, 3);
+
+	if(csvPath) {
+		csv = fopen(csvPath, "w");
+		if(!csv) {
+			perror(csvPath);
+			return 1;
+		}
+		fprintf(csv, "frame,line,first_write,writes,off_cadence,max_deviation\n");
+	}
+
+	avr_irq_register_notify(avr_iomem_getirq(avr, PORTD_ADDR, "portd", AVR_IOMEM_IRQ_ALL), portWritten, 0);
+	avr_irq_register_notify(avr_io_getirq(avr, AVR_IOCTL_IOPORT_GETIRQ(SYNC_PORT), SYNC_PIN), syncChanged, 0);
+
+	while(frame < firstFrame + maxFrames) {
+		if(simStep() == cpu_Done)
+			break;
+	}
+
+	if(csv)
+		fclose(csv);
+
+	if(frame < 0) {
+		printf("no vertical sync seen, does this simavr drive OC1A on the sync pin?\n");
+		return 1;
+	}
+
+	printf("%ld lines with pixels analyzed, %ld write intervals off the %d cycle cadence\n", linesAnalyzed, offCadence, cadence);
+	printf("first pixel write after the start of the line:\n");
+	for(int i = 0; i < MAX_OFFSET; i++)
+		if(firstWriteCount[i])
+			printf("  cycle %4d: %ld lines\n", i, firstWriteCount[i]);
+	return 0;
+}
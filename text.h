@@ -0,0 +1,51 @@
+// glyph strings packed by tools/textpack.py from assets/text.txt, do not edit
+
+// glyph of ascii characters 32-95 for charToGlyph, characters not in the font are blank
+PROGMEM prog_uchar asciiToGlyph[] = {
+	0,27,0,0,0,0,28,29,30,31,0,0,32,33,34,0,
+	35,36,37,38,39,40,41,42,43,44,0,0,0,0,0,45,
+	0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15,
+	16,17,18,19,20,21,22,23,24,25,26,0,0,0,0,0,
+};
+
+// OH NO!
+//
+// TOORUM'S BE-
+// LOVED PRINCESS
+// ADELA HAS BEEN
+// KIDNAPPED BY
+// EVIL MAHARADJA
+// KOVALSKY!
+PROGMEM prog_uchar textIntro1[] = {
+	0x0f,0x08,0x00,0x0e,0x0f,0x1b,0xfe,0xfe,0x14,0x0f,0x0f,0x12,0x15,0x0d,0x1d,0x13,
+	0x00,0x02,0x05,0x21,0xfe,0x0c,0x0f,0x16,0x05,0x04,0x00,0x10,0x12,0x09,0x0e,0x03,
+	0x05,0x13,0x13,0xfe,0x01,0x04,0x05,0x0c,0x01,0x00,0x08,0x01,0x13,0x00,0x02,0x05,
+	0x05,0x0e,0xfe,0x0b,0x09,0x04,0x0e,0x01,0x10,0x10,0x05,0x04,0x00,0x02,0x19,0xfe,
+	0x05,0x16,0x09,0x0c,0x00,0x0d,0x01,0x08,0x01,0x12,0x01,0x04,0x0a,0x01,0xfe,0x0b,
+	0x0f,0x16,0x01,0x0c,0x13,0x0b,0x19,0x1b,0xff,
+};
+
+// HELP TOORUM
+// FIND THE PRIN-
+// CESS BEFORE
+// THE MAHARADJA
+// SEDUCES HER!
+//
+// GO!!!
+PROGMEM prog_uchar textIntro2[] = {
+	0x08,0x05,0x0c,0x10,0x00,0x14,0x0f,0x0f,0x12,0x15,0x0d,0xfe,0x06,0x09,0x0e,0x04,
+	0x00,0x14,0x08,0x05,0x00,0x10,0x12,0x09,0x0e,0x21,0xfe,0x03,0x05,0x13,0x13,0x00,
+	0x02,0x05,0x06,0x0f,0x12,0x05,0xfe,0x14,0x08,0x05,0x00,0x0d,0x01,0x08,0x01,0x12,
+	0x01,0x04,0x0a,0x01,0xfe,0x13,0x05,0x04,0x15,0x03,0x05,0x13,0x00,0x08,0x05,0x12,
+	0x1b,0xfe,0xfe,0x07,0x0f,0x1b,0x1b,0x1b,0xff,
+};
+
+// GAME OVER
+PROGMEM prog_uchar textGameOver[] = {
+	0x07,0x01,0x0d,0x05,0x00,0x0f,0x16,0x05,0x12,0xff,
+};
+
+//  YOU WIN
+PROGMEM prog_uchar textYouWin[] = {
+	0x00,0x19,0x0f,0x15,0x00,0x17,0x09,0x0e,0xff,
+};
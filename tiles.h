@@ -1,5 +1,7 @@
+// tiles, generated by tools/tilepack.py from assets/tiles.txt and assets/tiles.pgm, do not edit
+// 33 tiles, 2112 bytes
 PROGMEM prog_uchar tiles[] = {
-	// tile 1
+	// tile 0, EMPTY
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -8,7 +10,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 2
+	// tile 1, PLAYER_LEFT
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0xb5,0x00,0x00,
@@ -17,7 +19,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x8d,0x8d,0x8d,0x00,0x00,
 	0x00,0x00,0x00,0x8d,0x00,0x8d,0x00,0x00,
 	0x00,0x00,0x00,0x8d,0x00,0x8d,0x00,0x00,
-	// tile 3
+	// tile 2, PLAYER_LEFT
 	0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,0x00,
 	0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,0x00,
@@ -26,7 +28,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x8d,0x69,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x8d,0x69,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x69,0x8d,0x00,0x00,0x00,
-	// tile 4
+	// tile 3, PLAYER_LEFT
 	0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,0x00,
 	0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,0x00,
@@ -35,7 +37,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x8d,0x8d,0x69,0x00,0x00,0x00,
 	0x00,0x00,0x8d,0x00,0x8d,0x00,0x00,0x00,
 	0x00,0x8d,0x8d,0x00,0x00,0x8d,0x00,0x00,
-	// tile 5
+	// tile 4, PLAYER_LEFT
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,
@@ -44,7 +46,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x00,0x8d,0x69,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x8d,0x8d,0x69,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x8d,0x00,0x00,
-	// tile 6
+	// tile 5, PLAYER_LEFT
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,
@@ -53,7 +55,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x00,0x8d,0x69,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x8d,0x69,0x00,0x00,
 	0x00,0x00,0x00,0x8d,0x8d,0x00,0x8d,0x00,
-	// tile 7
+	// tile 6, DOOR
 	0x0e,0x29,0x17,0x17,0x17,0x17,0x17,0x17,
 	0x0e,0x29,0x73,0x73,0x73,0x73,0x73,0x0e,
 	0x0e,0x4f,0x17,0x73,0x73,0x73,0x73,0x0e,
@@ -62,7 +64,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x0e,0x4f,0x17,0x73,0x73,0x17,0x73,0x0e,
 	0x0e,0x29,0x73,0x73,0x73,0x73,0x73,0x0e,
 	0x0e,0x29,0x4f,0x4f,0x4f,0x4f,0x4f,0x4f,
-	// tile 8
+	// tile 7, SPIKES
 	0x00,0x00,0xfe,0x00,0x00,0x00,0xfe,0x00,
 	0x00,0x00,0xb6,0x00,0x00,0x00,0xb6,0x00,
 	0x00,0x00,0xe0,0x00,0x00,0x00,0xb6,0x00,
@@ -71,7 +73,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0xe0,0x00,0x00,0x00,0xb6,0x00,
 	0x00,0x00,0x49,0x00,0x00,0x00,0x49,0x00,
 	0x00,0x49,0x24,0x49,0x00,0xe0,0x24,0x49,
-	// tile 9
+	// tile 8, PLAYER_RIGHT
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0xb5,0xb5,0xb5,0x00,0x00,0x00,
@@ -80,7 +82,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x8d,0x8d,0x8d,0x00,0x00,0x00,
 	0x00,0x00,0x8d,0x00,0x8d,0x00,0x00,0x00,
 	0x00,0x00,0x8d,0x00,0x8d,0x00,0x00,0x00,
-	// tile 10
+	// tile 9, PLAYER_RIGHT
 	0x00,0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,
 	0x00,0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,
 	0x00,0x00,0xb5,0xb5,0xb5,0x00,0x00,0x00,
@@ -89,7 +91,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x69,0x8d,0x00,0x00,0x00,
 	0x00,0x00,0x69,0x8d,0x00,0x8d,0x00,0x00,
 	0x00,0x00,0x8d,0x00,0x00,0x8d,0x00,0x00,
-	// tile 11
+	// tile 10, PLAYER_RIGHT
 	0x00,0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,
 	0x00,0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,0x00,
@@ -98,7 +100,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x69,0x8d,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x69,0x8d,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x8d,0x69,0x00,0x00,0x00,0x00,
-	// tile 12
+	// tile 11, PLAYER_RIGHT
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,0x00,
@@ -107,7 +109,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x8d,0x8d,0x8d,0x00,0x00,0x00,
 	0x00,0x8d,0x8d,0x69,0x00,0x00,0x00,0x00,
 	0x00,0x8d,0x00,0x69,0x69,0x00,0x00,0x00,
-	// tile 13
+	// tile 12, PLAYER_RIGHT
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0x00,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0x00,0x00,0x00,
@@ -116,7 +118,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x8d,0x8d,0x00,0x00,0x00,
 	0x00,0x00,0x8d,0x8d,0x00,0x69,0x00,0x00,
 	0x00,0x00,0x8d,0x00,0x00,0x69,0x00,0x00,
-	// tile 14
+	// tile 13, HEART
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0xec,0xec,0x00,0xec,0xec,0x00,0x00,
 	0xc0,0xe0,0xe0,0xec,0xe0,0xe0,0xec,0x00,
@@ -125,7 +127,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x84,0xe0,0xc0,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 15
+	// tile 14, HEART
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x84,0xec,0x00,0xec,0x84,0x00,0x00,
@@ -134,16 +136,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x84,0xe0,0xc0,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 16
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xec,0xec,0x00,0x00,0x00,0x00,0x00,
-	0xc0,0xe0,0xe0,0xec,0x00,0x00,0x00,0x00,
-	0x84,0xe0,0xe0,0xe0,0x00,0x00,0x00,0x00,
-	0x00,0x84,0xe0,0xe0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x84,0xe0,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x84,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 17
+	// tile 15, WALL
 	0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,
 	0x25,0x25,0x68,0x25,0x25,0x25,0x68,0x25,
 	0x25,0x25,0x25,0x00,0x25,0x25,0x25,0x68,
@@ -152,7 +145,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x00,
 	0x00,0x00,0x25,0x25,0x00,0x25,0x25,0x00,
 	0x00,0x25,0x25,0x25,0x00,0x00,0x00,0x25,
-	// tile 18
+	// tile 16, PRINCESS
 	0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,
 	0x00,0x00,0xff,0xd6,0xd6,0x00,0x00,0x00,
 	0x00,0x00,0xff,0xd6,0xd6,0x00,0x73,0x00,
@@ -161,7 +154,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0xa4,0xa4,0xd6,0xe8,0xd6,0x00,0x00,
 	0x00,0x00,0xe8,0xe8,0xe8,0x00,0x00,0x00,
 	0x00,0xa4,0xa4,0xe8,0xe8,0x00,0x00,0x00,
-	// tile 19
+	// tile 17, PRINCESS
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x73,
 	0x00,0x00,0xff,0xd6,0xd6,0x00,0x00,0x00,
@@ -170,7 +163,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0xa4,0xa4,0xd6,0xe8,0xd6,0x00,0x00,
 	0x00,0x00,0xe8,0xe8,0xe8,0x00,0x00,0x00,
 	0x00,0xa4,0xa4,0xe8,0xe8,0x00,0x00,0x00,
-	// tile 20
+	// tile 18, LADDER
 	0x00,0x4f,0x00,0x00,0x00,0x00,0x4f,0x00,
 	0x00,0x4f,0x17,0x17,0x17,0x17,0x4f,0x00,
 	0x00,0x4f,0x0e,0x73,0x73,0x0e,0x4f,0x00,
@@ -179,7 +172,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x4f,0x17,0x17,0x17,0x17,0x4f,0x00,
 	0x00,0x4f,0x0e,0x73,0x73,0x0e,0x4f,0x00,
 	0x00,0x4f,0x00,0x00,0x00,0x00,0x4f,0x00,
-	// tile 21
+	// tile 19, PLAYER_CLIMBING
 	0x00,0x00,0xb1,0x00,0xb1,0xb1,0x00,0x00,
 	0x00,0x00,0xb5,0x00,0xb1,0xb1,0x00,0x00,
 	0x00,0x00,0x6c,0xb5,0xb5,0xb5,0x00,0x00,
@@ -188,7 +181,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x8d,0x8d,0x8d,0x00,0x00,
 	0x00,0x00,0x00,0x8d,0x00,0x8d,0x00,0x00,
 	0x00,0x00,0x00,0x8d,0x00,0x00,0x00,0x00,
-	// tile 22
+	// tile 20, PLAYER_CLIMBING
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0xb1,0x00,
 	0x00,0x00,0x00,0xb1,0xb1,0x00,0xb5,0x00,
 	0x00,0x00,0x00,0xb5,0xb5,0xb5,0xb5,0x00,
@@ -197,7 +190,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x8d,0x8d,0x8d,0x00,0x00,
 	0x00,0x00,0x8d,0x8d,0x00,0x8d,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x8d,0x00,0x00,
-	// tile 23
+	// tile 21, KEY
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,
@@ -206,7 +199,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0xd4,0x00,0xfd,0x00,0x00,0xd4,0xfc,
 	0x00,0x00,0xd4,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 24
+	// tile 22, GHOST_LEFT
 	0x00,0x00,0x00,0x8f,0x8f,0x29,0x00,0x00,
 	0x00,0x00,0x8f,0x29,0x29,0x8f,0x00,0x00,
 	0x00,0x00,0x8f,0x29,0x29,0x8f,0x29,0x00,
@@ -215,7 +208,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x29,0x29,0x29,0x29,0x29,0x6e,0x00,
 	0x00,0x00,0x00,0x00,0x4e,0x29,0x4e,0x00,
 	0x00,0x00,0x00,0x6e,0x29,0x29,0x4e,0x00,
-	// tile 25
+	// tile 23, GHOST_LEFT
 	0x00,0x00,0x8f,0x8f,0x29,0x00,0x00,0x00,
 	0x00,0x8f,0x29,0x29,0x8f,0x00,0x00,0x00,
 	0x00,0x8f,0x29,0x29,0x8f,0x29,0x00,0x00,
@@ -224,7 +217,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x29,0x29,0x29,0x29,0x29,0x6e,0x00,
 	0x00,0x00,0x00,0x4e,0x29,0x29,0x00,0x00,
 	0x00,0x00,0x6e,0x29,0x29,0x4e,0x00,0x00,
-	// tile 26
+	// tile 24, GHOST_RIGHT
 	0x00,0x00,0x29,0x8f,0x8f,0x00,0x00,0x00,
 	0x00,0x00,0x8f,0x29,0x29,0x8f,0x00,0x00,
 	0x00,0x29,0x8f,0x29,0x29,0x8f,0x00,0x00,
@@ -233,7 +226,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x6e,0x29,0x29,0x29,0x29,0x29,0x00,
 	0x00,0x4e,0x29,0x4e,0x00,0x00,0x00,0x00,
 	0x00,0x4e,0x29,0x29,0x6e,0x00,0x00,0x00,
-	// tile 27
+	// tile 25, GHOST_RIGHT
 	0x00,0x00,0x00,0x29,0x8f,0x8f,0x00,0x00,
 	0x00,0x00,0x00,0x8f,0x29,0x29,0x8f,0x00,
 	0x00,0x00,0x29,0x8f,0x29,0x29,0x8f,0x00,
@@ -242,7 +235,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x6e,0x29,0x29,0x29,0x29,0x29,0x00,
 	0x00,0x00,0x29,0x29,0x4e,0x00,0x00,0x00,
 	0x00,0x00,0x4e,0x29,0x29,0x6e,0x00,0x00,
-	// tile 28
+	// tile 26, GOLD
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0xfc,0x00,0x00,0x00,0xfc,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -251,7 +244,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0xff,0xfc,0xfc,0xff,0x00,0xfc,
 	0xfc,0x00,0xfc,0xd4,0xd4,0xfc,0x00,0x00,
-	// tile 29
+	// tile 27, GOLD
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
@@ -260,7 +253,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,
 	0x00,0x00,0xff,0xfc,0xfc,0xff,0x00,0x00,
 	0x00,0x00,0xfc,0xd4,0xd4,0xfc,0x00,0x00,
-	// tile 30
+	// tile 28, WYVERN
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x76,0x00,0x00,0x00,0x00,0x00,0x00,0x76,
 	0x29,0x76,0x76,0x00,0x00,0x76,0x76,0x29,
@@ -269,7 +262,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x00,0x00,0x00,0x05,0x05,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x29,0x29,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
-	// tile 31
+	// tile 29, WYVERN
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x76,0x76,0x00,0x00,0x00,
 	0x00,0x76,0x76,0x05,0x05,0x76,0x76,0x00,
@@ -278,7 +271,7 @@ PROGMEM prog_uchar tiles[] = {
 	0x29,0x00,0x00,0x29,0x29,0x00,0x00,0x29,
 	0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 32
+	// tile 30, WALL_DARK
 	0x00,0x00,0x25,0x25,0x00,0x25,0x00,0x25,
 	0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x00,
 	0x25,0x25,0x25,0x00,0x25,0x25,0x25,0x00,
@@ -287,410 +280,22 @@ PROGMEM prog_uchar tiles[] = {
 	0x25,0x25,0x00,0x25,0x25,0x25,0x25,0x00,
 	0x25,0x25,0x00,0x00,0x25,0x25,0x25,0x00,
 	0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 33
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 34
-	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 35
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 36
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 37
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 38
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 39
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 40
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 41
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
+	// tile 31, WYVERN_2ND
 	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
 	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 42
-	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 43
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 44
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 45
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0x00,0xff,0xff,0x00,0xff,0x00,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 46
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
 	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 47
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 48
-	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
+	// tile 32, GHOST_LEFT_2ND
 	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 49
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 50
 	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
 	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
 	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 51
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 52
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 53
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 54
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 55
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0xff,0xff,0x00,0xff,0x00,0xff,0xff,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0x00,0xff,0xff,0xff,0x00,0xff,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0x00,0xff,0xff,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 56
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 57
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 58
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 59
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 60
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0xff,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 61
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 62
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 63
-	0x00,0x00,0x29,0x29,0x05,0x00,0x00,0x00,
-	0x00,0x05,0x00,0x00,0x00,0x29,0x00,0x00,
-	0x29,0x00,0x49,0x00,0x49,0x00,0x29,0x00,
-	0x29,0x00,0xb6,0x00,0xb6,0x00,0x29,0x00,
-	0x05,0x00,0x00,0x00,0x00,0x00,0x05,0x00,
-	0x29,0x00,0xb6,0x00,0xb6,0x00,0x29,0x00,
-	0x05,0x00,0xb6,0x00,0xb6,0x00,0x05,0x00,
-	0x29,0x29,0x29,0x29,0x29,0x29,0x29,0x00,
-	// tile 64
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,
-	// tile 65
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 66
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 67
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 68
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 69
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 70
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 71
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 72
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 73
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,
-	0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 74
-	0x00,0xff,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 75
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 76
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	// tile 77
-	0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,
-	0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,
-	0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,
 	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-
 };
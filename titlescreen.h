@@ -1,82 +1,89 @@
+// titlescreen, 128x80 pixels packed by tools/titlepack.py from assets/titlescreen.pgm, do not edit
+// 5746 bytes, 29 rows stored raw, see titlepack.py for the format
+
+#define TITLESCREEN_CHUNK_CYCLES	170
+
 PROGMEM prog_uchar titlescreen[] = {
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xbb,0xff,0xdf,0x77,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0x77,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xff,0xbb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x77,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0xff,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0xfc,0xfc,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x00,0xff,0xff,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x24,0x24,0x24,0x00,0xff,0xff,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x24,0x24,0x00,0xff,0xff,0xff,0xf4,0xf4,0xff,0xff,0xf4,0xf4,0xff,0x00,0xff,0xff,0xff,0xff,0xf4,0xf4,0x24,0x00,0xff,0xff,0xf4,0x00,0xff,0xf4,0xf4,0xf4,0x24,0x24,0x24,0x00,0xf4,0xf4,0xf4,0x00,0x24,0x00,0xf4,0x00,0x24,0x24,0x00,0x00,0xff,0xff,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
-	0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0xfc,0xfc,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x24,0x24,0x24,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x24,0x24,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x25,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xff,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0xff,0x00,0xfc,0xfc,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0xff,0xff,0xf8,0xf8,0x00,0x00,0x25,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xff,0xf8,0xf8,0x00,0x00,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x25,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0xf8,0x00,0x00,0x00,0x25,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xff,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x00,0x00,0x25,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x00,0xf4,0xf4,0xf4,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x00,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0xff,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x00,0xf4,0xf4,0xf0,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0xff,0xf4,0xf4,0xf0,0xff,0xf4,0xf4,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0xf4,0xf4,0x00,0x00,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0xf0,0x00,0xff,0xf0,0xf0,0xf0,0x00,0xf0,0x00,0x00,0xf0,0xf0,0xf0,0x00,0x00,0x25,0x25,0x25,0xff,0xff,0xf0,0xf0,0xff,0xff,0xff,0xff,0xf0,0xf0,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xff,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0xff,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x25,0x25,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0xec,0xec,0xec,0xec,0xec,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0x00,0xec,0xec,0x00,0x00,0xff,0xec,0x00,0x00,0x00,0x00,0x25,0x00,0xec,0xec,0x00,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0xec,0xec,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x25,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x25,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x25,0x25,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xff,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0xff,0xf0,0xf0,0xf0,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xbb,0xff,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xff,0xff,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0x77,0xbb,0xff,0xdf,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0x00,0xbb,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xff,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x77,0xff,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0xff,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0xdf,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0xff,0xff,0x00,0x25,0x25,0x00,0x00,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0x00,0xff,0xff,0xfc,0xfc,0x00,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xfc,0xfc,0x00,0x00,0xff,0xff,0xff,0xfc,0xfc,0x00,0x00,0xff,0xff,0xfc,0x00,0x25,0x00,0x00,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xff,0xff,0x00,0x25,0x00,0x00,0xff,0xff,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xff,0xff,0xff,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xff,0x00,0x00,0x25,0x00,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xff,0x00,0x00,0x25,0xff,0xff,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xfc,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0x00,0x00,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xfc,0xfc,0x00,0x00,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0xff,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x88,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x00,0xff,0xf8,0xf8,0x00,0x00,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0xff,0xf8,0xf8,0x00,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xff,0xff,0x00,0x00,0x25,0x25,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x6e,0x6e,0x6e,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x88,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x00,0xff,0xf8,0xf8,0x00,0x00,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0xff,0xf8,0xf8,0x00,0x00,0xf8,0xf8,0xf8,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0x00,0x00,0x00,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0x00,0x25,0x25,0x25,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6a,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x88,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x00,0xff,0xf8,0xf8,0x00,0x00,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0xff,0xf8,0xf8,0x00,0x00,0xf8,0xf8,0xf8,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x00,0x00,0x25,0x00,0xff,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x6e,0x49,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,0x6e,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x8d,0x8d,0x68,0x44,0x44,0x44,0x8d,0x8d,0x8d,0x8d,0x44,0x44,0x8d,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0xff,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0xff,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0xff,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0xff,0xff,0x77,0x00,0xff,0xf4,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x25,0x00,0x45,0x4a,0x6a,0x6e,0x4a,0x6e,0x6e,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x88,0x8d,0x8d,0x8d,0x8d,0x44,0x24,0x44,0x8d,0x68,0x44,0x20,0x24,0x91,0x25,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0xff,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf4,0xf4,0xbb,0x00,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6a,0x00,0x00,0x25,0x4a,0x4a,0x6e,0x6a,0x6e,0x6e,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x88,0x88,0x8d,0x8d,0x20,0x44,0x44,0x68,0x8d,0x8d,0x91,0x8d,0x44,0x68,0x8d,0x25,0x25,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0xff,0xf0,0xf0,0xf0,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x6e,0x25,0x00,0x00,0x00,0x45,0x4a,0x6a,0x6e,0x4a,0x6a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x8d,0x8d,0x20,0x20,0x20,0x44,0x91,0x8d,0x91,0x8d,0x20,0x20,0x8d,0x25,0x25,0x25,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0x00,0x25,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xff,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x6e,0x00,0x00,0x00,0x00,0x20,0x4a,0x4a,0x6a,0x6a,0x4a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x68,0x8d,0x8d,0x20,0x00,0x20,0x68,0x8d,0x8d,0x91,0x8d,0x00,0x20,0x8d,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0x00,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0x00,0xff,0xec,0x00,0x00,0x00,0x25,0x25,0x00,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x00,0x77,0xbb,0xff,0xdf,0x77,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0x00,0x25,0x25,0x25,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,0x6e,0x6a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x68,0x8d,0x8d,0x68,0x44,0x44,0x8d,0x8d,0x8d,0x91,0x8d,0x24,0x20,0x8d,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0xec,0xec,0xec,0x00,0x00,0x00,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0x77,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,0x6a,0x6e,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x68,0x8d,0x8d,0x8d,0x91,0x91,0x8d,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x77,0xff,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,0x4a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x44,0x68,0x8d,0x68,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xff,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x4a,0x4a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x8d,0x8d,0x8d,0x8d,0x44,0x44,0x20,0x20,0x20,0x44,0x24,0x44,0x68,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xdf,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x8d,0x8d,0x44,0x44,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x20,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x4a,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x88,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x24,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x8c,0x8d,0x8d,0x8d,0x8d,0x44,0x20,0x44,0x44,0x8d,0x6c,0x88,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6d,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x68,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x91,0xb5,0xb5,0x91,0x91,0x48,0x48,0x24,0x48,0x48,0x48,0x48,0x48,0x24,0x44,0x6d,0x6d,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x04,0x2c,0x2c,0x28,0x2c,0x28,0x00,0x00,
-	0x25,0x25,0x25,0x25,0x25,0x25,0x91,0xb5,0xd9,0xd9,0x91,0x91,0x91,0x91,0x44,0x24,0x24,0x24,0x20,0x24,0x24,0x6d,0x91,0x91,0xb5,0xd9,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x50,0x30,0x2c,0x28,0x2c,0x2c,0x00,0x00,
-	0x25,0x25,0x25,0x25,0x25,0x24,0x91,0x91,0xb5,0xb5,0xb5,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x24,0x24,0x91,0x91,0x91,0x6d,0x91,0x91,0xd9,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x24,0x49,0x71,0x30,0x2c,0x28,0x2c,0x30,0x28,0x25,0x4a,
-	0x25,0x25,0x25,0x25,0x24,0x91,0x91,0x91,0xb5,0xb5,0xb5,0x48,0x91,0x91,0x91,0x91,0x91,0x91,0x24,0x44,0x91,0x91,0xb5,0x6d,0x91,0x91,0xd9,0xd9,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x24,0x75,0x30,0x29,0x24,0x2c,0x30,0x2c,0x24,0x25,0x25,
-	0x25,0x25,0x25,0x25,0x91,0x91,0x91,0x91,0x91,0xb5,0x6c,0x6d,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x68,0x91,0x91,0xb5,0xb5,0x6d,0x91,0x91,0xb5,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x50,0x30,0x2d,0x25,0x25,0x50,0x79,0x28,0x25,0x25,0x25,
-	0x25,0x25,0x25,0x24,0x91,0x91,0x91,0x91,0xb5,0xb5,0x48,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x48,0x6d,0x91,0x91,0x91,0xb5,0x48,0x91,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x24,0x24,0x24,0x2c,0x30,0x2c,0x29,0x25,0x25,0x55,0x55,0x24,0x25,0x25,0x45,
-	0x25,0x25,0x24,0x6d,0x91,0x91,0x91,0x91,0xb5,0x48,0x6c,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x48,0x6d,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x6e,0x6e,0x6e,0x30,0x30,0x49,0x45,0x45,0x4a,0x79,0x30,0x04,0x25,0x25,0x25,
-	0x25,0x25,0x00,0x6d,0x91,0x91,0x91,0x91,0x6d,0x44,0x6d,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x48,0x6d,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x6e,0x6e,0x6e,0x30,0x30,0x4a,0x45,0x45,0x6a,0x79,0x30,0x24,0x25,0x45,0x4a,
-	0x25,0x00,0x6d,0x6d,0x91,0x91,0x91,0x91,0x48,0x24,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x44,0x48,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6a,0x6e,0x6e,0x6e,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0x51,0x30,0x25,0x25,0x6e,0x6e,
-	0x25,0x00,0x6d,0x6d,0x6d,0x48,0x48,0x48,0x48,0x48,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x6d,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x29,0x4a,0x6e,0x6e,0x6e,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0x30,0x2c,0x25,0x25,0x6e,0x6e,
-	0x25,0x00,0x6d,0x6d,0x91,0x91,0x44,0x44,0x44,0x68,0x68,0x44,0x64,0x68,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x6d,0x6d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x30,0x30,0x29,0x45,0x6e,0x6e,0x6e,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0x30,0x29,0x25,0x45,0x6e,0x6e,
-	0x25,0x00,0x6d,0x6d,0x91,0x6d,0x44,0x44,0x8d,0x8d,0x8d,0x8d,0x91,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x6d,0x6d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x00,0x30,0x55,0x30,0x29,0x25,0x6e,0x6e,0x6e,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0x28,0x24,0x25,0x4a,0x6e,0x6e,
-	0x25,0x00,0x6d,0x6d,0x91,0x6d,0x44,0x68,0x8d,0x8d,0x8d,0x8d,0x91,0x68,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x24,0x6d,0x6d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x30,0x79,0x30,0x2d,0x2d,0x25,0x6e,0x6e,0x6e,0x6e,0x6a,0x4a,0x45,0x4a,0x6a,0x45,0x25,0x25,0x4a,0x6e,0x6e,
-	0x25,0x00,0x6d,0x49,0x6d,0x6d,0x68,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x68,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x20,0x48,0x48,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x30,0x51,0x30,0x29,0x00,0x25,0x6e,0x6e,0x6e,0x6e,0x6a,0x4a,0x25,0x4a,0x4a,0x6a,0x4a,0x25,0x6a,0x6e,0x6e,
-	0x24,0x00,0x48,0x48,0x48,0x48,0x68,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x91,0x91,0x68,0x68,0x8d,0x8d,0x68,0x8d,0x8d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x30,0x55,0x2c,0x29,0x00,0x2c,0x25,0x4a,0x6e,0x6e,0x6e,0x4a,0x49,0x45,0x4a,0x4a,0x6e,0x6e,0x25,0x6a,0x6e,0x6a,
-	0x24,0x00,0x48,0x48,0x48,0x48,0x68,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x91,0x91,0x24,0x68,0x8d,0x8d,0x44,0x68,0x8d,0x8d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x30,0x30,0x29,0x00,0x2c,0x30,0x25,0x45,0x6a,0x6a,0x6a,0x4a,0x4a,0x49,0x4a,0x4a,0x6e,0x6e,0x45,0x6a,0x6e,0x45,
-	0x24,0x00,0x48,0x48,0x48,0x48,0x44,0x68,0x88,0x89,0x68,0x68,0x68,0x68,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x6d,0x91,0x20,0x68,0x6d,0x8d,0x44,0x44,0x8d,0x8d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x30,0x30,0x00,0x00,0x30,0x50,0x25,0x25,0x4a,0x6a,0x4a,0x4a,0x4a,0x45,0x45,0x4a,0x6e,0x6e,0x4a,0x6e,0x00,0x00,
-	0x24,0x24,0x48,0x48,0x48,0x48,0x44,0x68,0x48,0x44,0x44,0x44,0x24,0x44,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x48,0x91,0x20,0x68,0x68,0x8d,0x44,0x44,0x8d,0x8d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x30,0x2c,0x00,0x00,0x55,0x51,0x25,0x25,0x6a,0x6a,0x4a,0x4a,0x4a,0x45,0x45,0x4a,0x6e,0x6e,0x4a,0x6e,0x00,0x00,
-	0x24,0x24,0x00,0x00,0x00,0x00,0x68,0x68,0x68,0x6c,0x6d,0x8d,0x6d,0x71,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x48,0x48,0x20,0x68,0x44,0x44,0x68,0x68,0x8d,0x8d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x2c,0x00,0x00,0x30,0x55,0x2c,0x24,0x25,0x6a,0x4a,0x4a,0x4a,0x4a,0x25,0x45,0x4a,0x6e,0x6e,0x4a,0x6e,0x49,0x00,
-	0x24,0x24,0x24,0x24,0x24,0x24,0x48,0x6d,0x48,0x48,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x24,0x48,0x48,0x48,0x00,0x68,0x44,0x68,0x8d,0x8d,0x88,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x2c,0x00,0x45,0x4a,0x4a,0x4a,0x4a,0x45,0x25,0x25,0x4a,0x6e,0x6e,0x4a,0x6a,0x6e,0x00,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x44,0x44,0x48,0x48,0x48,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x44,0x24,0x48,0x48,0x20,0x44,0x44,0x44,0x44,0x44,0x44,0x44,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x55,0x2d,0x00,0x00,0x00,0x4a,0x4a,0x4a,0x4a,0x25,0x25,0x25,0x4a,0x6e,0x6e,0x4a,0x6a,0x6e,0x6e,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x6d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x44,0x24,0x20,0x20,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x29,0x00,0x00,0x00,0x45,0x4a,0x4a,0x25,0x25,0x25,0x25,0x4a,0x6e,0x6e,0x4a,0x6a,0x6e,0x6e,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x89,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x2c,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x4a,0x6e,0x6e,0x4a,0x4a,0x6e,0x6e,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x69,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0xad,0x8d,0x89,0x8d,0x8d,0x8d,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x29,0x00,0x00,0x00,0x00,0x25,0x25,0x45,0x25,0x25,0x25,0x25,0x4a,0x6e,0x6e,0x4a,0x4a,0x6e,0x6e,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x69,0x8d,0x8d,0x8d,0x89,0x8d,0x8d,0x8d,0xad,0xad,0xad,0x8d,0x69,0x89,0x8d,0xad,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x2d,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x4a,0x6a,0x6e,0x4a,0x4a,0x6e,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x69,0x89,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0xad,0x8d,0x69,0x69,0x8d,0x8d,0xad,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x29,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x4a,0x4a,0x6e,0x6e,0x6e,0x6e,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x69,0x69,0x8d,0x8d,0x8d,0x69,0x69,0x00,0x00,0x00,0x69,0x69,0x69,0x8d,0x8d,0x8d,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x4a,0x4a,0x6a,0x6e,0x6e,0x30,0x30,
-	0x00,0x00,0x00,0x00,0x00,0x00,0x69,0x69,0x69,0x89,0x8d,0x8d,0x69,0x69,0x00,0x00,0x00,0x00,0x69,0x69,0x8d,0x8d,0x8d,0xad,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x4a,0x4a,0x6a,0x6e,0x6e,0x30,0x30,
+	0x12,0x01,0x77,0xff,	// first chunk
+	0x00,0x12,0x01,0xbb,0xff,0xff,	// row 0, decoded
+	0x00,0x12,0x01,0xff,0xff,0xff,	// row 1, decoded
+	0x00,0x14,0x9d,0xff,0xff,0x00,0x8a,0xff,0xff,	// row 2, decoded
+	0x00,0x10,0x05,0x77,0xbb,0xff,0xdf,0x77,0x00,0x92,0xfc,0xff,0x00,0x93,0xfc,0x00,0x01,0x00,0xff,	// row 3, decoded
+	0x00,0x0e,0x0a,0xbb,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0x77,0x21,0x01,0x00,0xff,0xff,	// row 4, decoded
+	0x00,0x0e,0x06,0x00,0x00,0x00,0x77,0xff,0xbb,0x00,0x88,0x00,0x03,0x85,0x00,0xff,0x00,0x95,0x00,0x28,0x82,0xff,0xff,	// row 5, decoded
+	0x00,0x11,0x03,0x00,0xff,0x77,0x0a,0x01,0x00,0x42,0x82,0xec,0xff,0xff,	// row 6, decoded
+	0x00,0x12,0x02,0xdf,0x00,0xff,0xff,	// row 7, decoded
+	0x00,0x12,0x01,0xbb,0x15,0x84,0xff,0x08,0x84,0xff,0x08,0x82,0xff,0x02,0x82,0xff,0xff,0x06,0x82,0xff,0x04,0x05,0xff,0x00,0xff,0xff,0xff,0x05,0x83,0xff,0x0c,0x82,0xff,0xff,	// row 8, decoded
+	0x00,0x00,0x9b,0x25,0xff,0x01,0x82,0xff,0x02,0x85,0x25,0x03,0x82,0x00,0x02,0x05,0xff,0xff,0x00,0x25,0x25,0xff,	// row 9, decoded
+	0x01,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0xfc,0xfc,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x00,0xff,0xff,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x24,0x24,0x24,0x00,0xff,0xff,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x24,0x24,0x00,0xff,0xff,0xff,0xf4,0xf4,0xff,0xff,0xf4,0xf4,0xff,0x00,0xff,0xff,0xff,0xff,0xf4,0xf4,0x24,0x00,0xff,0xff,0xf4,0x00,0xff,0xf4,0xf4,0xf4,0x24,0x24,0x24,0x00,0xf4,0xf4,0xf4,0x00,0x24,0x00,0xf4,0x00,0x24,0x24,0x00,0x00,0xff,0xff,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x03,0x82,0x00,0x02,0x04,0xff,0xff,0x00,0x25,0x02,0x85,0xff,0x03,0x01,0xff,0x03,0x81,0xff,0xff,0x00,0x81,0xff,0x04,0x82,0xff,0x02,0x82,0x00,0x01,0x85,0xff,0x02,0x01,0x00,0xff,	// row 10, raw
+	0x01,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x00,0xfc,0xfc,0x00,0x00,0x24,0x24,0x24,0x24,0x24,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x24,0x24,0x24,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x24,0x24,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x24,0x24,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x02,0x84,0x25,0x01,0x84,0xff,0x01,0x03,0x00,0xff,0xff,0x02,0x86,0x25,0xff,0x00,0x8a,0x25,0xff,	// row 11, raw
+	0x00,0x1c,0x82,0xf8,0x06,0x04,0xff,0xff,0xf8,0xf8,0x02,0x09,0x25,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xff,0xf8,0xff,0x00,0x01,0xf8,0x02,0x10,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x25,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x00,0xf8,0x00,0xff,	// row 12, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xff,0x00,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0xff,0x00,0xfc,0xfc,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x03,0x00,0x00,0x25,0x01,0x84,0xf8,0x02,0x83,0xf8,0x01,0x82,0xff,0x00,0x82,0xf8,0xff,0x00,0x87,0xf8,0x01,0x01,0x25,0x05,0x88,0xf8,0xff,	// row 13, raw
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xff,0xff,	// row 14, raw
+	0x00,0x25,0x01,0xf8,0x0b,0x01,0xf8,0x0a,0x01,0x00,0x07,0x82,0x25,0x0f,0x01,0xf8,0x0f,0x03,0x25,0x00,0xff,0xff,0xff,	// row 15, decoded
+	0x00,0x1c,0x82,0xf0,0x06,0x0f,0x25,0x00,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0x00,0x00,0x00,0x00,0xf0,0xff,0x00,0x08,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0x00,0x03,0x84,0xf0,0x04,0x82,0x25,0x02,0x01,0xf0,0xff,	// row 16, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x00,0xf4,0xf4,0xf4,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x00,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0xff,0xf4,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x08,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0xf0,0x02,0x09,0xf0,0xf0,0xf0,0x00,0xf0,0x00,0x00,0xf0,0xf0,0xff,0x00,0x03,0xf0,0x00,0x00,0x03,0x0a,0xff,0xff,0xf0,0xf0,0xff,0xff,0xff,0xff,0xf0,0xf0,0x02,0x01,0x00,0xff,	// row 17, raw
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x00,0xf4,0xf4,0xf0,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0x00,0xff,0xf4,0xf4,0xf0,0xff,0xf4,0xf4,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0xf4,0xf4,0x00,0x00,0x00,0x00,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xff,0xff,	// row 18, raw
+	0x00,0x2a,0x04,0xf0,0xf0,0x00,0x00,0x08,0x04,0xf0,0xf0,0xf0,0x00,0x08,0x01,0xff,0x0b,0x82,0xf0,0x07,0x81,0x00,0xff,0x00,0x82,0x00,0x04,0x01,0x00,0x05,0x02,0x00,0xf0,0x02,0x84,0xf0,0x01,0x01,0x00,0xff,	// row 19, decoded
+	0x00,0x1c,0x02,0x00,0x25,0x07,0x07,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x02,0x85,0x25,0x00,0x81,0x00,0xff,0x00,0x85,0x00,0x02,0x83,0x25,0x00,0x87,0x00,0x04,0x82,0x25,0xff,	// row 20, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0xec,0xec,0xec,0xec,0xec,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0xec,0x00,0xec,0xec,0x00,0x00,0xff,0xec,0x00,0x00,0x00,0x00,0x25,0x00,0xec,0xec,0x00,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0xec,0xec,0xec,0xec,0xec,0x00,0x00,0x00,0x00,0x00,0x25,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x8c,0x00,0x02,0x05,0x25,0x25,0x00,0x00,0x00,0x02,0x83,0x25,0xff,0x00,0x83,0x25,0x00,0x87,0x00,0x03,0x02,0x25,0xbb,0xff,	// row 21, raw
+	0x00,0x1b,0x03,0x25,0x25,0x00,0x02,0x05,0xff,0xf0,0xf0,0xf0,0x00,0x02,0x87,0x25,0xff,0x05,0x92,0x25,0x06,0x83,0x25,0x04,0x81,0x25,0xff,	// row 22, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x25,0x00,0x00,0x25,0x25,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0xff,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x89,0x25,0x01,0x90,0xf0,0xff,0x00,0x83,0xf0,0x00,0x03,0xbb,0xff,0x77,0xff,	// row 23, raw
+	0x00,0x1c,0x0a,0x00,0x00,0xff,0xff,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0x29,0x82,0xff,0x0c,0x01,0x00,0xff,0x00,0x91,0xf4,0x00,0x01,0x77,0x02,0x02,0xdf,0x77,0xff,	// row 24, decoded
+	0x00,0x1b,0x02,0x00,0xff,0x00,0x88,0xfc,0x27,0x07,0x00,0x00,0xff,0xfc,0xfc,0x00,0x00,0xff,0x09,0x12,0x25,0x25,0x25,0x25,0x00,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xff,	// row 25, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0xfc,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0xfc,0xfc,0xfc,0xfc,0x00,0x00,0xff,0xfc,0xfc,0xfc,0xfc,0x00,0xbb,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0x77,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x06,0x00,0x00,0x77,0xff,0xbb,0x25,0xff,0xff,	// row 26, raw
+	0x00,0x1c,0x01,0xfc,0x02,0x83,0x00,0x03,0x02,0xfc,0x00,0x26,0x02,0xff,0xfc,0x11,0x01,0x25,0x06,0x02,0x25,0xff,0xff,0x05,0x05,0x25,0x25,0x25,0xff,0x77,0xff,	// row 27, decoded
+	0x00,0x22,0x01,0x00,0x07,0x84,0x00,0x02,0x83,0x00,0x05,0x84,0x00,0x08,0x83,0x00,0xff,0x00,0x81,0x00,0x29,0x02,0xdf,0x25,0xff,	// row 28, decoded
+	0x00,0x21,0x03,0x25,0x00,0xff,0x03,0x0b,0x00,0xff,0xff,0xff,0xfc,0xfc,0x00,0x00,0xff,0xff,0xfc,0x02,0x01,0x00,0xff,0x00,0x12,0x00,0xff,0xff,0xfc,0xfc,0xfc,0xfc,0xff,0xff,0x00,0x25,0x00,0x00,0xff,0xff,0xff,0xfc,0xfc,0xff,	// row 29, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x00,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0xff,0xff,0x00,0x25,0x25,0x00,0x00,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0x00,0x00,0x00,0xff,0xff,0xfc,0xfc,0x00,0x25,0x25,0x25,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xfc,0xfc,0xfc,0x00,0x00,0x25,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x25,0x25,0x25,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x06,0xfc,0x00,0x00,0x25,0x00,0xff,0x04,0x05,0xfc,0xff,0xff,0xff,0x00,0x1b,0x01,0x25,0xff,0xff,	// row 30, raw
+	0x00,0x28,0x03,0x00,0xfc,0xfc,0x05,0x01,0xfc,0x02,0x0b,0x00,0xff,0xfc,0xfc,0x00,0x00,0x00,0x00,0xfc,0xfc,0xfc,0xff,0x00,0x08,0x00,0x00,0xff,0xfc,0xfc,0xfc,0x00,0x00,0x04,0x04,0xff,0xff,0xfc,0xfc,0x04,0x03,0xfc,0xfc,0x00,0xff,	// row 31, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xff,0x00,0x00,0x25,0x00,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xff,0xff,0xff,0x00,0x00,0x25,0xff,0xff,0xff,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x02,0x00,0x00,0xff,0xff,	// row 32, raw
+	0x00,0x0e,0x88,0x8d,0x13,0x01,0xff,0x0a,0x01,0xfc,0x06,0x03,0xff,0xfc,0x00,0x02,0x01,0xfc,0xff,0x03,0x01,0xfc,0x01,0x87,0x00,0x04,0x83,0x00,0x02,0x01,0x25,0xff,	// row 33, decoded
+	0x00,0x0b,0x03,0x88,0x8d,0x8d,0x08,0x82,0x8d,0x04,0x83,0xf8,0x05,0x82,0xf8,0x04,0x83,0xf8,0xff,0x03,0x82,0xf8,0x02,0x09,0xf8,0xf8,0xf8,0x00,0xf8,0xf8,0xf8,0xf8,0x00,0x03,0x04,0x00,0xf8,0xf8,0xf8,0xff,	// row 34, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x88,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x00,0xff,0xf8,0xf8,0x00,0x00,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0xff,0xf8,0xf8,0x00,0x00,0xf8,0xf8,0xf8,0x00,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0xf8,0xf8,0xf8,0xf8,0xf8,0xf8,0xff,0xff,0x00,0x00,0x25,0x25,0x00,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf8,0xf8,0xf8,0x00,0x00,0x25,0xff,0xf8,0xf8,0xf8,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x6e,0x6e,0x6e,0x25,0x25,0x25,0x00,0x0d,0xf8,0xf8,0xf8,0xf8,0x00,0x25,0x25,0x25,0x00,0xff,0xf8,0xf8,0xf8,0x02,0x83,0x25,0xff,0x0c,0x83,0xf8,0x04,0x83,0xf8,0x0a,0x01,0x6a,0x00,0x89,0x6e,0xff,	// row 35, raw
+	0x00,0x0a,0x01,0x68,0x0d,0x01,0x8d,0x22,0x01,0x00,0x03,0x03,0x25,0x00,0xff,0x07,0x01,0x00,0x2c,0x03,0x6e,0x6e,0x49,0xff,0xff,	// row 36, decoded
+	0x00,0x10,0x09,0x44,0x24,0x44,0x8d,0x68,0x44,0x20,0x24,0x91,0x02,0x08,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0x00,0x00,0xff,0x00,0x03,0x00,0x00,0x00,0x04,0x83,0xf4,0x03,0x82,0xf4,0x02,0x06,0xf4,0xf4,0xf4,0xf4,0xf4,0x00,0xff,	// row 37, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x8d,0x8d,0x68,0x44,0x44,0x44,0x8d,0x8d,0x8d,0x8d,0x44,0x44,0x8d,0x25,0x25,0x00,0xf4,0xf4,0xf4,0xf4,0xff,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0xff,0xf4,0xf4,0x00,0x00,0xf4,0xf4,0xf4,0xf4,0xff,0x00,0x00,0x00,0x00,0x00,0x25,0x00,0xff,0xff,0x77,0x00,0xff,0xf4,0xf4,0xf4,0xf4,0x00,0x25,0x25,0x00,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0xf4,0xf4,0xf4,0x00,0x00,0x25,0xff,0xf4,0xf4,0xf4,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x25,0x00,0x45,0x4a,0x6a,0x6e,0x4a,0x6e,0x6e,0x00,0x01,0x00,0x04,0x0a,0x00,0xf4,0xf4,0xbb,0x00,0x00,0x00,0xf4,0xf4,0xf4,0x05,0x83,0xf4,0xff,0x02,0x01,0x00,0x0e,0x83,0xf4,0x04,0x83,0xf4,0x0a,0x08,0x6a,0x00,0x00,0x25,0x4a,0x4a,0x6e,0x6a,0xff,	// row 38, raw
+	0x00,0x08,0x84,0x68,0x02,0x0b,0x20,0x00,0x20,0x68,0x8d,0x8d,0x91,0x8d,0x00,0x20,0x8d,0x03,0x01,0x25,0xff,0x00,0x11,0x25,0x00,0xec,0xec,0xec,0xec,0xec,0xec,0xec,0x00,0x25,0x25,0x25,0x00,0xec,0xec,0xec,0xff,	// row 39, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x88,0x88,0x8d,0x8d,0x20,0x44,0x44,0x68,0x8d,0x8d,0x91,0x8d,0x44,0x68,0x8d,0x25,0x25,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0xff,0xf0,0xf0,0xf0,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x6e,0x25,0x00,0x00,0x00,0x45,0x4a,0x6a,0x6e,0x4a,0x6a,0x02,0x02,0xec,0x00,0x02,0x06,0x25,0x25,0x00,0xec,0xec,0xec,0x06,0x07,0x77,0xbb,0xff,0xdf,0x77,0x00,0x00,0xff,0x00,0x02,0x00,0x00,0x03,0x06,0x25,0x25,0x00,0xec,0xec,0xec,0x02,0x82,0x00,0x06,0x82,0x00,0xff,	// row 40, raw
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x8d,0x8d,0x20,0x20,0x20,0x44,0x91,0x8d,0x91,0x8d,0x20,0x20,0x8d,0x25,0x25,0x25,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0x00,0x25,0x00,0x00,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0xf0,0xf0,0xf0,0xff,0xf0,0xf0,0xf0,0xf0,0x00,0x00,0x00,0x00,0x25,0x00,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xf0,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xff,0xff,0xf0,0xf0,0xf0,0xf0,0xf0,0xff,0x00,0x00,0x25,0x25,0x25,0x25,0x6e,0x00,0x00,0x00,0x00,0x20,0x4a,0x4a,0x6a,0x6a,0x4a,0x00,0x93,0xec,0x00,0x01,0x00,0x03,0x02,0x4a,0x00,0xff,0x02,0x07,0x00,0x00,0x00,0x4a,0x4a,0x6e,0x6a,0xff,	// row 41, raw
+	0x00,0x08,0x01,0x25,0x05,0x0a,0x8d,0x8d,0x8d,0x8d,0x44,0x68,0x8d,0x68,0x8d,0x8d,0x06,0x86,0x25,0xff,0x00,0x82,0x00,0x04,0x97,0x25,0xff,	// row 42, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x68,0x8d,0x8d,0x68,0x44,0x44,0x8d,0x8d,0x8d,0x91,0x8d,0x24,0x20,0x8d,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0xec,0xec,0xec,0x00,0x00,0x00,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbb,0xbb,0xff,0xff,0xff,0xff,0xff,0xff,0xbb,0x77,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x4a,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,0x6a,0x6e,0x00,0x81,0x25,0x01,0x01,0x77,0x00,0x86,0x25,0x04,0x88,0x25,0xff,0x06,0x9a,0x25,0xff,	// row 43, raw
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x68,0x68,0x68,0x68,0x8d,0x8d,0x8d,0x91,0x91,0x8d,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x8d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x77,0xff,0xbb,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x25,0x25,0x25,0x25,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x4a,0x4a,0x4a,0x06,0x04,0x00,0x25,0x4a,0x4a,0xff,0xff,	// row 44, raw
+	0x00,0x09,0x01,0x25,0x06,0x09,0x44,0x44,0x20,0x20,0x20,0x44,0x24,0x44,0x68,0x0b,0x83,0x25,0x1b,0x01,0xdf,0xff,0x00,0x01,0x25,0x32,0x01,0x24,0x06,0x01,0x00,0xff,	// row 45, decoded
+	0x00,0x0e,0x04,0x44,0x44,0x20,0x20,0x03,0x84,0x20,0x29,0x01,0xbb,0x33,0x01,0x25,0x07,0x01,0x25,0xff,0xff,	// row 46, decoded
+	0x00,0x0c,0x01,0x88,0x01,0x8b,0x8d,0x29,0x01,0x25,0x3b,0x02,0x00,0x24,0xff,0xff,	// row 47, decoded
+	0x00,0x0c,0x02,0x68,0x8c,0x04,0x07,0x44,0x20,0x44,0x44,0x8d,0x6c,0x88,0x66,0x01,0x00,0xff,0xff,	// row 48, decoded
+	0x00,0x0d,0x8c,0x68,0x2c,0x05,0xf4,0xf4,0x25,0xf4,0xf4,0xff,0xff,	// row 49, decoded
+	0x00,0x0a,0x01,0x6d,0x0d,0x01,0x25,0x16,0x82,0xf4,0x07,0x82,0xf4,0x11,0x82,0xf4,0x04,0x82,0xf4,0xff,0x04,0x82,0xf4,0x1e,0x01,0x25,0xff,	// row 50, decoded
+	0x00,0x04,0x12,0x24,0x91,0x91,0x91,0xb5,0xb5,0xb5,0x48,0x91,0x91,0x91,0x91,0x91,0x91,0x24,0x44,0x91,0x91,0xff,0x00,0x06,0xb5,0x6d,0x91,0x91,0xd9,0xd9,0x06,0x84,0xf4,0x02,0x83,0xf4,0x09,0x82,0xf4,0xff,	// row 51, decoded
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x91,0xb5,0xb5,0x91,0x91,0x48,0x48,0x24,0x48,0x48,0x48,0x48,0x48,0x24,0x44,0x6d,0x6d,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x04,0x2c,0x2c,0x28,0x2c,0x28,0x00,0x00,0x09,0x05,0xf4,0xf4,0x25,0xf4,0xf4,0x0a,0x82,0xf4,0x04,0x82,0xf4,0x04,0x05,0xf4,0xf4,0x25,0xf4,0xf4,0xff,0x00,0x04,0x25,0xf4,0xf4,0xf4,0x03,0x05,0xf4,0xf4,0x25,0xf4,0xf4,0x09,0x06,0x24,0x24,0x75,0x30,0x29,0x24,0xff,	// row 52, raw
+	0x01,0x25,0x25,0x25,0x25,0x25,0x25,0x91,0xb5,0xd9,0xd9,0x91,0x91,0x91,0x91,0x44,0x24,0x24,0x24,0x20,0x24,0x24,0x6d,0x91,0x91,0xb5,0xd9,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x50,0x30,0x2c,0x28,0x2c,0x2c,0x00,0x00,0x00,0x06,0x2c,0x30,0x2c,0x24,0x25,0x25,0xff,0xff,	// row 53, raw
+	0x01,0x25,0x25,0x25,0x25,0x25,0x24,0x91,0x91,0xb5,0xb5,0xb5,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x24,0x24,0x91,0x91,0x91,0x6d,0x91,0x91,0xd9,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x24,0x49,0x71,0x30,0x2c,0x28,0x2c,0x30,0x28,0x25,0x4a,0xff,0xff,	// row 54, raw
+	0x00,0x02,0x03,0x24,0x6d,0x91,0x04,0x03,0x48,0x6c,0x6d,0x06,0x82,0x91,0x02,0x06,0x91,0xb5,0x48,0x6d,0x91,0x91,0xff,0x06,0x89,0x25,0x04,0x03,0x25,0xf4,0xf4,0x02,0x06,0x25,0xf4,0xf4,0x25,0x25,0x25,0xff,	// row 55, decoded
+	0x01,0x25,0x25,0x25,0x25,0x91,0x91,0x91,0x91,0x91,0xb5,0x6c,0x6d,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x68,0x91,0x91,0xb5,0xb5,0x6d,0x91,0x91,0xb5,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x50,0x30,0x2d,0x25,0x25,0x50,0x79,0x28,0x25,0x25,0x25,0x00,0x02,0xf4,0xf4,0x03,0x85,0x25,0x0a,0x8e,0x25,0xff,0x00,0x8f,0x25,0x05,0x07,0x6e,0x6e,0x6e,0x6e,0x30,0x30,0x49,0xff,	// row 56, raw
+	0x01,0x25,0x25,0x25,0x24,0x91,0x91,0x91,0x91,0xb5,0xb5,0x48,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x48,0x6d,0x91,0x91,0x91,0xb5,0x48,0x91,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x24,0x24,0x24,0x24,0x2c,0x30,0x2c,0x29,0x25,0x25,0x55,0x55,0x24,0x25,0x25,0x45,0x00,0x07,0x45,0x45,0x4a,0x79,0x30,0x04,0x25,0xff,0xff,	// row 57, raw
+	0x00,0x01,0x0b,0x00,0x6d,0x6d,0x6d,0x48,0x48,0x48,0x48,0x48,0x6d,0x91,0x0c,0x03,0x24,0x48,0x6d,0x08,0x01,0xf4,0xff,0x00,0x0a,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x13,0x82,0xf4,0x0b,0x03,0xf4,0xf4,0x25,0xff,	// row 58, decoded
+	0x01,0x25,0x25,0x00,0x6d,0x91,0x91,0x91,0x91,0x6d,0x44,0x6d,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x48,0x6d,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6e,0x6e,0x6e,0x6e,0x30,0x30,0x4a,0x45,0x45,0x6a,0x79,0x30,0x24,0x25,0x45,0x4a,0x00,0x12,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xff,0x00,0x05,0xf4,0xf4,0x25,0xf4,0xf4,0x05,0x04,0x00,0x00,0x29,0x4a,0x03,0x06,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0xff,	// row 59, raw
+	0x01,0x25,0x00,0x6d,0x6d,0x91,0x91,0x91,0x91,0x48,0x24,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x44,0x48,0x91,0x91,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x6a,0x6e,0x6e,0x6e,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0x51,0x30,0x25,0x25,0x6e,0x6e,0x00,0x06,0x30,0x2c,0x25,0x25,0x6e,0x6e,0xff,0xff,	// row 60, raw
+	0x00,0x04,0x0a,0x91,0x91,0x44,0x44,0x44,0x68,0x68,0x44,0x64,0x68,0x0d,0x01,0x6d,0x09,0x01,0xf4,0x39,0x02,0xf4,0x25,0xff,0x00,0x01,0x25,0x0b,0x04,0x30,0x30,0x29,0x45,0x0a,0x03,0x29,0x25,0x45,0xff,	// row 61, decoded
+	0x00,0x00,0x08,0x24,0x00,0x48,0x48,0x48,0x48,0x68,0x68,0x00,0x86,0x8d,0x0c,0x03,0x91,0x91,0x68,0xff,0x00,0x06,0x68,0x8d,0x8d,0x68,0x8d,0x8d,0x00,0x91,0x24,0xff,	// row 62, decoded
+	0x01,0x25,0x00,0x6d,0x6d,0x91,0x6d,0x44,0x44,0x8d,0x8d,0x8d,0x8d,0x91,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x6d,0x6d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x25,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0xf4,0x25,0x25,0xf4,0xf4,0x25,0xf4,0xf4,0x25,0x25,0x25,0x00,0x30,0x55,0x30,0x29,0x25,0x6e,0x6e,0x6e,0x6e,0x6e,0x6a,0x45,0x4a,0x6a,0x28,0x24,0x25,0x4a,0x6e,0x6e,0x00,0x9d,0x24,0xff,0x00,0x99,0x24,0x00,0x01,0x30,0xff,	// row 63, raw
+	0x01,0x25,0x00,0x6d,0x6d,0x91,0x6d,0x44,0x68,0x8d,0x8d,0x8d,0x8d,0x91,0x68,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x24,0x6d,0x6d,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x30,0x79,0x30,0x2d,0x2d,0x25,0x6e,0x6e,0x6e,0x6e,0x6a,0x4a,0x45,0x4a,0x6a,0x45,0x25,0x25,0x4a,0x6e,0x6e,0x00,0x07,0x55,0x2c,0x29,0x00,0x2c,0x25,0x4a,0x03,0x02,0x4a,0x49,0x02,0x06,0x4a,0x6e,0x6e,0x25,0x6a,0x6e,0xff,0x00,0x01,0x6a,0xff,	// row 64, raw
+	0x01,0x25,0x00,0x6d,0x49,0x6d,0x6d,0x68,0x68,0x8d,0x8d,0x8d,0x8d,0x8d,0x68,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x20,0x48,0x48,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x25,0x30,0x51,0x30,0x29,0x00,0x25,0x6e,0x6e,0x6e,0x6e,0x6a,0x4a,0x25,0x4a,0x4a,0x6a,0x4a,0x25,0x6a,0x6e,0x6e,0xff,0xff,	// row 65, raw
+	0x00,0x1c,0x01,0x24,0x03,0x04,0x44,0x68,0x8d,0x8d,0x47,0x0a,0x30,0x29,0x00,0x2c,0x30,0x25,0x45,0x6a,0x6a,0x6a,0xff,0x00,0x03,0x4a,0x4a,0x49,0x04,0x01,0x45,0x02,0x01,0x45,0xff,	// row 66, decoded
+	0x00,0x06,0x08,0x44,0x68,0x88,0x89,0x68,0x68,0x68,0x68,0x0c,0x05,0x6d,0x91,0x20,0x68,0x6d,0x02,0x01,0x44,0xff,0x4a,0x09,0x00,0x00,0x30,0x50,0x25,0x25,0x4a,0x6a,0x4a,0x02,0x82,0x45,0x03,0x04,0x4a,0x6e,0x00,0x00,0xff,	// row 67, decoded
+	0x00,0x01,0x01,0x24,0x06,0x06,0x48,0x44,0x44,0x44,0x24,0x44,0x0c,0x01,0x48,0x03,0x01,0x68,0x4c,0x01,0x2c,0xff,0x02,0x02,0x55,0x51,0x02,0x01,0x6a,0xff,	// row 68, decoded
+	0x00,0x00,0x86,0x00,0x01,0x04,0x44,0x48,0x48,0x48,0x00,0x8a,0x6d,0xff,0x00,0x83,0x6d,0x00,0x04,0x44,0x24,0x48,0x48,0x01,0x87,0x44,0x00,0x83,0x00,0xff,	// row 69, decoded
+	0x01,0x24,0x24,0x00,0x00,0x00,0x00,0x68,0x68,0x68,0x6c,0x6d,0x8d,0x6d,0x71,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0x91,0xb5,0x24,0x48,0x48,0x48,0x20,0x68,0x44,0x44,0x68,0x68,0x8d,0x8d,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x24,0x2c,0x00,0x00,0x30,0x55,0x2c,0x24,0x25,0x6a,0x4a,0x4a,0x4a,0x4a,0x25,0x45,0x4a,0x6e,0x6e,0x4a,0x6e,0x49,0x00,0x00,0x9d,0x00,0xff,0x00,0x9d,0x00,0xff,	// row 70, raw
+	0x01,0x24,0x24,0x24,0x24,0x24,0x24,0x48,0x6d,0x48,0x48,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x6d,0x91,0x91,0x91,0x91,0x91,0x91,0x24,0x48,0x48,0x48,0x00,0x68,0x44,0x68,0x8d,0x8d,0x88,0x68,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x30,0x2c,0x00,0x45,0x4a,0x4a,0x4a,0x4a,0x45,0x25,0x25,0x4a,0x6e,0x6e,0x4a,0x6a,0x6e,0x00,0x00,0x8b,0x00,0x00,0x08,0x30,0x55,0x2d,0x00,0x00,0x00,0x4a,0x4a,0xff,0x02,0x83,0x25,0x04,0x03,0x6a,0x6e,0x6e,0xff,	// row 71, raw
+	0x00,0x06,0x01,0x6d,0x00,0x90,0x24,0x00,0x04,0x44,0x24,0x20,0x20,0xff,0x00,0x01,0x00,0x01,0x87,0x00,0x49,0x02,0x30,0x29,0x03,0x01,0x45,0x02,0x01,0x25,0xff,	// row 72, decoded
+	0x00,0x06,0x92,0x89,0x00,0x85,0x00,0xff,0x50,0x02,0x2c,0x00,0x03,0x83,0x25,0x08,0x01,0x4a,0xff,	// row 73, decoded
+	0x00,0x06,0x82,0x69,0x00,0x8a,0x8d,0x00,0x06,0xad,0x8d,0x89,0x8d,0x8d,0x8d,0xff,0x55,0x01,0x29,0x06,0x01,0x45,0xff,	// row 74, decoded
+	0x00,0x0b,0x01,0x89,0x03,0x05,0xad,0xad,0xad,0x8d,0x69,0x02,0x82,0xad,0x54,0x01,0x2d,0x05,0x84,0x00,0xff,0x00,0x82,0x00,0x02,0x01,0x6a,0x04,0x01,0x30,0xff,	// row 75, decoded
+	0x00,0x08,0x01,0x89,0x02,0x01,0x8d,0x03,0x06,0x8d,0xad,0x8d,0x69,0x69,0x8d,0x57,0x02,0x29,0x00,0x0c,0x02,0x4a,0x6e,0xff,0x00,0x02,0x6e,0x6e,0xff,	// row 76, decoded
+	0x00,0x08,0x01,0x69,0x03,0x06,0x69,0x69,0x00,0x00,0x00,0x69,0x04,0x01,0x8d,0x55,0x01,0x00,0x0e,0x01,0x6a,0xff,0x02,0x01,0x30,0xff,	// row 77, decoded
+	0x00,0x09,0x01,0x89,0x07,0x01,0x00,0xff,0xff,	// row 78, decoded
+	0x00,0xff,0xff,	// row 79, decoded
+	0x00,	// end
 };
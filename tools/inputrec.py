@@ -0,0 +1,151 @@
+#!/usr/bin/env python3
+"""Recorded controller input (.tqr files) for replays on the host build and in the simulator.
+
+Usage:
+  inputrec.py encode [-n reads] script.txt out.tqr		convert an input script to a recording
+  inputrec.py decode in.tqr							print a recording as an input script
+  inputrec.py info in.tqr								print the header
+  inputrec.py hash									print the build hash of the sources
+
+controllerState is the only input of the game and updateController reads it once per game tick (once per
+frame on the titlescreen), so a recording is the button byte of every controller read from power up.
+Input scripts are the text format of the simulator tools, see sim/README.md.
+
+File format, little endian:
+  'TQR1'
+  uint32	build hash, FNV-1a of the game sources the recording was made for, 0 if unknown
+  uint8		start state, 0 = power up (the only one so far)
+  uint8[3]	reserved, 0
+  uint32	number of controller reads
+  runs of (uint8 count 1-255, uint8 buttons) until the reads are covered, buttons as in gamepad.h
+"""
+
+import glob
+import os
+import struct
+import sys
+
+MAGIC = b'TQR1'
+HEADER = '<4sIB3xI'
+START_POWER_UP = 0
+
+BUTTONS = ['RIGHT', 'LEFT', 'DOWN', 'UP', 'START', 'SELECT', 'B', 'A']
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+def build_hash():
+	"""FNV-1a over the names and contents of the game sources in the repository root."""
+	h = 0x811c9dc5
+	files = sorted(glob.glob(os.path.join(ROOT, '*.ino')) + glob.glob(os.path.join(ROOT, '*.cpp')) +
+		glob.glob(os.path.join(ROOT, '*.h')))
+	for path in files:
+		for b in os.path.basename(path).encode() + b'\0' + open(path, 'rb').read():
+			h = ((h ^ b) * 0x01000193) & 0xffffffff
+	return h
+
+def parse_buttons(text):
+	buttons = 0
+	for name in text.split():
+		if name not in BUTTONS:
+			raise ValueError('unknown button %s' % name)
+		buttons |= 1 << BUTTONS.index(name)
+	return buttons
+
+def format_buttons(buttons):
+	return ' '.join(name for i, name in enumerate(BUTTONS) if buttons & (1 << i))
+
+def read_script(path):
+	"""Returns a list of (read, buttons)."""
+	lines = []
+	for n, line in enumerate(open(path), 1):
+		line = line.split('#')[0].strip()
+		if not line:
+			continue
+		fields = line.split(None, 1)
+		try:
+			read = int(fields[0])
+			buttons = parse_buttons(fields[1] if len(fields) > 1 else '')
+		except ValueError as e:
+			sys.exit('%s:%d: %s' % (path, n, e))
+		if lines and read <= lines[-1][0]:
+			sys.exit('%s:%d: read numbers must increase' % (path, n))
+		lines.append((read, buttons))
+	return lines
+
+def encode(script, reads):
+	states = []
+	for i, (read, buttons) in enumerate(script):
+		end = script[i + 1][0] if i + 1 < len(script) else reads
+		if not states and read > 0:
+			states.append((read, 0))
+		states.append((min(end, reads) - read, buttons))
+
+	data = bytearray(struct.pack(HEADER, MAGIC, build_hash(), START_POWER_UP, reads))
+	for count, buttons in states:
+		while count > 0:
+			n = min(count, 255)
+			data += bytes([n, buttons])
+			count -= n
+	return bytes(data)
+
+def decode(data):
+	"""Returns (build hash, start state, reads, list of (read, buttons) changes)."""
+	if len(data) < struct.calcsize(HEADER):
+		raise ValueError('file is too short')
+	magic, build, start, reads = struct.unpack_from(HEADER, data)
+	if magic != MAGIC:
+		raise ValueError('not a recording')
+	changes = []
+	read = 0
+	pos = struct.calcsize(HEADER)
+	while read < reads:
+		if pos + 2 > len(data):
+			raise ValueError('recording ends after %d of %d reads' % (read, reads))
+		count, buttons = data[pos], data[pos + 1]
+		if count == 0:
+			raise ValueError('run of length 0 at byte %d' % pos)
+		if not changes or changes[-1][1] != buttons:
+			changes.append((read, buttons))
+		read += count
+		pos += 2
+	return build, start, reads, changes
+
+def main():
+	args = sys.argv[1:]
+	if not args:
+		sys.exit(__doc__)
+	cmd = args.pop(0)
+
+	if cmd == 'hash':
+		print('0x%08x' % build_hash())
+
+	elif cmd == 'encode':
+		reads = None
+		if len(args) == 4 and args[0] == '-n':
+			reads = int(args[1])
+			args = args[2:]
+		if len(args) != 2:
+			sys.exit(__doc__)
+		script = read_script(args[0])
+		if reads is None:
+			reads = script[-1][0] + 1 if script else 0
+		open(args[1], 'wb').write(encode(script, reads))
+
+	elif cmd in ('decode', 'info') and len(args) == 1:
+		try:
+			build, start, reads, changes = decode(open(args[0], 'rb').read())
+		except ValueError as e:
+			sys.exit('%s: %s' % (args[0], e))
+		current = build_hash()
+		print('# build 0x%08x%s, start %s, %d reads' % (build,
+			'' if build == current else ' (sources are 0x%08x)' % current,
+			'power up' if start == START_POWER_UP else 'unknown (%d)' % start, reads))
+		if cmd == 'decode':
+			for read, buttons in changes:
+				print('%d\t%s' % (read, format_buttons(buttons)))
+
+	else:
+		sys.exit(__doc__)
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,129 @@
+#!/usr/bin/env python3
+"""Plays a recording on the host build and on the firmware in the simulator and compares the game state.
+
+Usage:
+  lockstep.py [--host host/tqreplay] [--sim sim/tqsnap] recording.tqr firmware.elf
+  lockstep.py --compare host.snap sim.snap
+
+Both sides write a snapshot of the player, the enemies, the tile map and the room state at every controller
+read (see sim/snapshot.h). They are compared read by read. The first read where they differ is reported
+with the fields that differ, and the script exits with 1. Reads are compared rather than frames because a
+frame the firmware drops delays its ticks without changing them.
+"""
+
+import os
+import struct
+import subprocess
+import sys
+import tempfile
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+# sim/snapshot.h
+MAGIC = b'TQS1'
+NUM_TILES_X = 13
+TMAP = 58
+TMAP_SIZE = 130
+ROOMSTATE = 318
+GLYPH = 0x100
+OTHER = 0xffff
+
+FIELDS = [
+	# name, offset, struct format
+	('p.frame', 8, 'B'), ('p.x', 9, 'b'), ('p.y', 10, 'b'), ('p.dir', 11, 'b'), ('p.walkPhase', 12, 'B'),
+	('p.room', 13, 'B'), ('p.score', 14, '<H'), ('p.health', 16, 'B'), ('p.time', 17, '<H'), ('p.vely', 19, 'b'),
+	('p.jumpTimer', 20, 'B'), ('p.climbing', 21, 'B'), ('p.climbPhase', 22, 'B'), ('p.hurtTimer', 23, 'B'),
+	('p.gameover', 24, 'B'), ('numEnemies', 25, 'B'),
+]
+for i in range(4):
+	base = 26 + i * 8
+	FIELDS += [('enemies[%d].%s' % (i, name), base + n, fmt) for n, (name, fmt) in enumerate([
+		('x', 'b'), ('y', 'b'), ('oy', 'b'), ('dir', 'b'), ('frame', 'B'), ('walkPhase', 'B'), ('sprite', 'B'),
+		('updateFunc', 'B')])]
+
+FUNCS = {0: 'none', 1: 'updateWyvern', 2: 'updateGhost', 0xff: 'other'}
+
+def read_snapshots(path):
+	data = open(path, 'rb').read()
+	if data[:4] != MAGIC:
+		sys.exit('%s: not a snapshot file' % path)
+	size = struct.unpack_from('<H', data, 4)[0]
+	return size, [data[i:i + size] for i in range(6, len(data) - size + 1, size)]
+
+def tile_name(v):
+	if v == OTHER:
+		return 'other'
+	if v >= GLYPH:
+		return 'glyph %d' % (v - GLYPH)
+	return 'tile %d' % v
+
+def field_diff(a, b):
+	lines = []
+	for name, offset, fmt in FIELDS:
+		va = struct.unpack_from(fmt, a, offset)[0]
+		vb = struct.unpack_from(fmt, b, offset)[0]
+		if va != vb:
+			if name.endswith('updateFunc'):
+				va, vb = FUNCS.get(va, va), FUNCS.get(vb, vb)
+			lines.append('  %-24s host %-14s sim %s' % (name, va, vb))
+	for i in range(TMAP_SIZE):
+		va = struct.unpack_from('<H', a, TMAP + i * 2)[0]
+		vb = struct.unpack_from('<H', b, TMAP + i * 2)[0]
+		if va != vb:
+			lines.append('  %-24s host %-14s sim %s' % ('tmap[%d] (%d,%d)' % (i, i % NUM_TILES_X, i // NUM_TILES_X),
+				tile_name(va), tile_name(vb)))
+	for i in range(ROOMSTATE, len(a)):
+		if a[i] != b[i]:
+			lines.append('  %-24s host 0x%02x%-10s sim 0x%02x' % ('roomstate[%d]' % (i - ROOMSTATE), a[i], '', b[i]))
+	return lines
+
+def compare(host_path, sim_path):
+	host_size, host = read_snapshots(host_path)
+	sim_size, sim = read_snapshots(sim_path)
+	if host_size != sim_size:
+		sys.exit('snapshot sizes differ: host %d bytes, sim %d bytes (roomstate sizes differ?)' % (host_size, sim_size))
+
+	n = min(len(host), len(sim))
+	for i in range(n):
+		# the frame number is not part of the state
+		if host[i][8:] != sim[i][8:]:
+			read = struct.unpack_from('<I', host[i], 0)[0]
+			frames = struct.unpack_from('<I', host[i], 4)[0], struct.unpack_from('<I', sim[i], 4)[0]
+			print('first difference before read %d (host frame %d, sim frame %d)' % (read, frames[0], frames[1]))
+			if i > 0:
+				print('read %d still matched' % (read - 1))
+			print('\n'.join(field_diff(host[i], sim[i])))
+			return 1
+
+	if len(host) != len(sim):
+		print('host has %d snapshots, sim %d' % (len(host), len(sim)))
+	frames = (struct.unpack_from('<I', host[n - 1], 4)[0], struct.unpack_from('<I', sim[n - 1], 4)[0]) if n else (0, 0)
+	print('%d reads match (host %d frames, sim %d frames)' % (n, frames[0], frames[1]))
+	return 0 if len(host) == len(sim) else 1
+
+def main():
+	args = sys.argv[1:]
+	if len(args) == 3 and args[0] == '--compare':
+		sys.exit(compare(args[1], args[2]))
+
+	host = os.path.join(ROOT, 'host', 'tqreplay')
+	sim = os.path.join(ROOT, 'sim', 'tqsnap')
+	while len(args) > 2 and args[0] in ('--host', '--sim'):
+		if args[0] == '--host':
+			host = args[1]
+		else:
+			sim = args[1]
+		args = args[2:]
+	if len(args) != 2:
+		sys.exit(__doc__)
+	recording, elf = args
+
+	with tempfile.TemporaryDirectory() as tmp:
+		host_snap = os.path.join(tmp, 'host.snap')
+		sim_snap = os.path.join(tmp, 'sim.snap')
+		subprocess.run([host, '-q', '-s', host_snap, recording], check=True)
+		subprocess.run([sim, '-i', recording, elf, sim_snap], check=True, stdout=subprocess.DEVNULL)
+		sys.exit(compare(host_snap, sim_snap))
+
+if __name__ == '__main__':
+	main()
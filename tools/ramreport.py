@@ -0,0 +1,72 @@
+#!/usr/bin/env python3
+"""Reports the static RAM used by each module of a build.
+
+Usage: ramreport.py [--nm avr-nm] [--symbols] build_dir_or_objects...
+
+Give the build directory of the sketch (for the Arduino IDE it is printed with verbose compile
+output enabled) or the object files themselves. The .data and .bss symbols of every object file
+are summed with avr-nm, the stack gets whatever is left of the 2 KB of SRAM. At run time the
+stack headroom that was never used is shown on the free RAM page of the DEBUG_PROFILE overlay
+(see profile.h).
+"""
+
+import os
+import subprocess
+import sys
+
+RAM_SIZE = 2048
+
+def find_objects(paths):
+	objects = []
+	for path in paths:
+		if os.path.isdir(path):
+			for root, dirs, files in os.walk(path):
+				objects += [os.path.join(root, f) for f in sorted(files) if f.endswith('.o')]
+		else:
+			objects.append(path)
+	return objects
+
+def read_symbols(nm, obj):
+	"""Returns a list of (size, section, name) for the RAM symbols of obj."""
+	out = subprocess.run([nm, '-S', '-C', obj], capture_output=True, text=True, check=True).stdout
+	symbols = []
+	for line in out.split('\n'):
+		fields = line.split(None, 3)
+		if len(fields) == 4 and fields[2] in 'bBdD':
+			section = '.data' if fields[2] in 'dD' else '.bss'
+			symbols.append((int(fields[1], 16), section, fields[3]))
+	return symbols
+
+def main():
+	args = sys.argv[1:]
+	nm = 'avr-nm'
+	if '--nm' in args:
+		i = args.index('--nm')
+		nm = args[i + 1]
+		del args[i:i + 2]
+	show_symbols = '--symbols' in args
+	args = [a for a in args if a != '--symbols']
+	if not args:
+		sys.exit(__doc__)
+
+	modules = []
+	for obj in find_objects(args):
+		symbols = read_symbols(nm, obj)
+		if symbols:
+			data = sum(s for s, section, _ in symbols if section == '.data')
+			bss = sum(s for s, section, _ in symbols if section == '.bss')
+			modules.append((data + bss, data, bss, os.path.basename(obj), symbols))
+
+	modules.sort(reverse=True)
+	print('%6s %6s %6s  %s' % ('total', 'data', 'bss', 'module'))
+	for total, data, bss, name, symbols in modules:
+		print('%6d %6d %6d  %s' % (total, data, bss, name))
+		if show_symbols:
+			for size, section, sym in sorted(symbols, reverse=True):
+				print('%20d %-5s  %s' % (size, section, sym))
+
+	used = sum(m[0] for m in modules)
+	print('%6d bytes of static RAM, %d bytes left for the stack' % (used, RAM_SIZE - used))
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+"""Converts the game's fixed text to glyph strings in text.h.
+
+Usage: textpack.py [assets/text.txt] [text.h]
+
+Text regions show glyphs from font.h, so the strings are stored as glyph numbers and drawText and
+textWriter copy them to tmap without looking anything up. Each line ends with GLYPH_NEWLINE
+and each string with GLYPH_END (see videogen.h). The ASCII table used by charToGlyph for
+text built at runtime is generated from the same charset.
+"""
+
+import os
+import sys
+
+# font.h glyph order, glyph 0 is blank
+CHARSET = " ABCDEFGHIJKLMNOPQRSTUVWXYZ!&'(),-.0123456789?"
+
+GLYPH_NEWLINE = 0xfe
+GLYPH_END = 0xff
+
+ASCII_FIRST = 0x20
+ASCII_COUNT = 64
+
+def read_strings(path):
+	strings = []
+	for n, line in enumerate(open(path).read().split('\n'), 1):
+		if line.startswith('#'):
+			continue
+		if line.startswith('[') and line.rstrip().endswith(']'):
+			strings.append((line.strip()[1:-1], []))
+		elif strings:
+			strings[-1][1].append(line.rstrip('\r'))
+		elif line.strip():
+			sys.exit('%s:%d: text before the first [name]' % (path, n))
+	for name, lines in strings:
+		while lines and not lines[-1].strip():
+			lines.pop()
+	return strings
+
+def to_glyphs(path, name, lines):
+	glyphs = []
+	for i, line in enumerate(lines):
+		if i > 0:
+			glyphs.append(GLYPH_NEWLINE)
+		for ch in line:
+			if ch not in CHARSET:
+				sys.exit('%s: [%s] has %r, which is not in the font' % (path, name, ch))
+			glyphs.append(CHARSET.index(ch))
+	return glyphs + [GLYPH_END]
+
+def main():
+	root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+	src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'assets', 'text.txt')
+	dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, 'text.h')
+
+	ascii = [CHARSET.index(chr(c)) if chr(c) in CHARSET else 0 for c in range(ASCII_FIRST, ASCII_FIRST + ASCII_COUNT)]
+	strings = [(name, lines, to_glyphs(src, name, lines)) for name, lines in read_strings(src)]
+
+	with open(dst, 'w') as f:
+		f.write('// glyph strings packed by tools/textpack.py from assets/text.txt, do not edit\n')
+		f.write('\n')
+		f.write('// glyph of ascii characters %d-%d for charToGlyph, characters not in the font are blank\n' % (ASCII_FIRST, ASCII_FIRST + ASCII_COUNT - 1))
+		f.write('PROGMEM prog_uchar asciiToGlyph[] = {\n')
+		for i in range(0, ASCII_COUNT, 16):
+			f.write('\t%s,\n' % ','.join('%d' % g for g in ascii[i:i + 16]))
+		f.write('};\n')
+		for name, lines, glyphs in strings:
+			f.write('\n')
+			for line in lines:
+				f.write(('// ' + line).rstrip() + '\n')
+			f.write('PROGMEM prog_uchar %s[] = {\n' % name)
+			for i in range(0, len(glyphs), 16):
+				f.write('\t%s,\n' % ','.join('0x%02x' % g for g in glyphs[i:i + 16]))
+			f.write('};\n')
+
+	print('%s: %d strings, %d bytes' % (dst, len(strings), ASCII_COUNT + sum(len(g) for _, _, g in strings)))
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,160 @@
+#!/usr/bin/env python3
+"""Builds tiles.h and the TILE_* constants in tq.h from the tile sheet.
+
+Usage: tilepack.py [assets/tiles.txt] [assets/tiles.pgm]
+
+The sheet is a binary PGM of 8x8 tiles whose byte values are the video port colors. tiles.txt lists
+the tiles in index order (see the comments there). Mirrored frames are generated from the sheet.
+Entries whose TILE_ name is not used anywhere in the sources are left out of tiles.h and tq.h, the
+entries after them move down. Entries identical to an earlier one share its index. Left out entries,
+duplicate frames and the flash cost are reported.
+"""
+
+import os
+import re
+import sys
+
+TILE_BYTES = 64
+BEGIN_MARKER = '// tile indices, generated by tools/tilepack.py from assets/tiles.txt\n'
+END_MARKER = '// end of tile indices\n'
+
+def read_sheet(path):
+	data = open(path, 'rb').read()
+	fields = data.split(None, 4)
+	width, height = int(fields[1]), int(fields[2])
+	if fields[0] != b'P5' or int(fields[3]) != 255 or width % 8 or height % 8:
+		sys.exit('%s: expected a binary PGM with maxval 255 and a size divisible by 8' % path)
+	pixels = fields[4][-width * height:]
+	tiles = []
+	for ty in range(height // 8):
+		for tx in range(width // 8):
+			tiles.append(tuple(pixels[(ty * 8 + y) * width + tx * 8 + x] for y in range(8) for x in range(8)))
+	return tiles
+
+def mirror(tile):
+	return tuple(tile[y * 8 + 7 - x] for y in range(8) for x in range(8))
+
+def read_list(path, sheet):
+	"""Returns [(name, frames, mirrorOf, comment)]."""
+	entries = []
+	names = {}
+	for n, line in enumerate(open(path), 1):
+		line, _, comment = line.partition('#')
+		fields = line.split()
+		if not fields:
+			continue
+		where = '%s:%d' % (path, n)
+		name = fields[0]
+		if name in names:
+			sys.exit('%s: %s is listed twice' % (where, name))
+		if len(fields) == 3 and fields[1] == 'mirror':
+			if fields[2] not in names:
+				sys.exit('%s: %s must be listed before it is mirrored' % (where, fields[2]))
+			frames = [mirror(t) for t in names[fields[2]]]
+			mirrorOf = fields[2]
+		else:
+			frames = []
+			for src in fields[1:]:
+				m = re.match(r'^(~?)(\d+)(?:-(\d+))?$', src)
+				if not m:
+					sys.exit('%s: bad frame %r' % (where, src))
+				first = int(m.group(2))
+				last = int(m.group(3) or first)
+				for i in range(first, last + 1):
+					if i >= len(sheet):
+						sys.exit('%s: the sheet has only %d tiles' % (where, len(sheet)))
+					frames.append(mirror(sheet[i]) if m.group(1) else sheet[i])
+			if not frames:
+				sys.exit('%s: %s has no frames' % (where, name))
+			mirrorOf = None
+		names[name] = frames
+		entries.append((name, frames, mirrorOf, comment.strip()))
+	return entries
+
+def used_names(root):
+	"""TILE_ names used by the sources, outside of the generated constants."""
+	used = set()
+	for f in os.listdir(root):
+		if not f.endswith(('.cpp', '.h', '.ino')) or f == 'tiles.h':
+			continue
+		text = open(os.path.join(root, f)).read()
+		if BEGIN_MARKER in text:
+			text = text[:text.index(BEGIN_MARKER)] + text[text.index(END_MARKER):]
+		used.update(re.findall(r'\bTILE_([A-Z0-9_]+)\b', text))
+	return used
+
+def main():
+	root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+	listPath = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'assets', 'tiles.txt')
+	sheetPath = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, 'assets', 'tiles.pgm')
+
+	sheet = read_sheet(sheetPath)
+	entries = read_list(listPath, sheet)
+	used = used_names(root)
+
+	tiles = []		# (frame, name) in index order
+	defines = []	# (name, index, comment)
+	notes = []
+	for name, frames, mirrorOf, comment in entries:
+		if name not in used:
+			if mirrorOf:
+				notes.append('TILE_%s is not used, mirror of %s not generated' % (name, mirrorOf))
+			else:
+				notes.append('TILE_%s is not used, left out (%d bytes)' % (name, len(frames) * TILE_BYTES))
+			continue
+
+		# share the index of an identical earlier entry
+		index = None
+		for i in range(len(tiles) - len(frames) + 1):
+			if [t for t, _ in tiles[i:i + len(frames)]] == frames:
+				index = i
+				notes.append('TILE_%s is identical to %s, sharing index %d' % (name, tiles[i][1], i))
+				break
+		if index is None:
+			index = len(tiles)
+			for f, frame in enumerate(frames):
+				for t, other in tiles:
+					if t == frame:
+						notes.append('TILE_%s frame %d duplicates a frame of %s' % (name, f, other))
+						break
+				tiles.append((frame, name))
+
+		if not comment and len(frames) > 1:
+			comment = 'tiles %d-%d' % (index, index + len(frames) - 1)
+		defines.append((name, index, comment))
+
+	if len(tiles) > 256:
+		sys.exit('%d tiles, tile indices are 8 bits' % len(tiles))
+
+	with open(os.path.join(root, 'tiles.h'), 'w') as f:
+		f.write('// tiles, generated by tools/tilepack.py from assets/tiles.txt and assets/tiles.pgm, do not edit\n')
+		f.write('// %d tiles, %d bytes\n' % (len(tiles), len(tiles) * TILE_BYTES))
+		f.write('PROGMEM prog_uchar tiles[] = {\n')
+		for i, (tile, name) in enumerate(tiles):
+			f.write('\t// tile %d, %s\n' % (i, name))
+			for y in range(8):
+				f.write('\t%s,\n' % ','.join('0x%02x' % p for p in tile[y * 8:y * 8 + 8]))
+		f.write('};\n')
+
+	lines = [BEGIN_MARKER]
+	for name, index, comment in defines:
+		line = '#define TILE_%s' % name
+		line += '\t' * max(1, (32 - len(line) + 3) // 4) + '%d' % index
+		if comment:
+			line += '\t\t// ' + comment
+		lines.append(line + '\n')
+	lines.append(END_MARKER)
+
+	tqPath = os.path.join(root, 'tq.h')
+	tq = open(tqPath).read()
+	if BEGIN_MARKER not in tq or END_MARKER not in tq:
+		sys.exit('%s: tile index markers not found' % tqPath)
+	tq = tq[:tq.index(BEGIN_MARKER)] + ''.join(lines) + tq[tq.index(END_MARKER) + len(END_MARKER):]
+	open(tqPath, 'w').write(tq)
+
+	for note in notes:
+		print('note: ' + note)
+	print('%d tiles, %d bytes of flash' % (len(tiles), len(tiles) * TILE_BYTES))
+
+if __name__ == '__main__':
+	main()
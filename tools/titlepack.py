@@ -0,0 +1,220 @@
+#!/usr/bin/env python3
+"""Packs the titlescreen image into titlescreen.h as row deltas.
+
+Usage: titlepack.py [assets/titlescreen.pgm] [titlescreen.h]
+
+The source is a binary 128x80 PGM whose byte values are the video port colors.
+
+The titlescreen shows each row of pixels on two scanlines. A row is either stored raw and
+streamed from flash like the old titlescreen, or decoded into a linebuf half as a delta
+against the last decoded row. The decoder runs in chunks after the last pixel of every scanline,
+so each chunk must fit in the cycles left there (CHUNK_CYCLES, checked against
+TITLE_CHUNK_CYCLES in videogen.h). The packer picks the raw rows so that every decoded
+row is complete before it is shown and the stream is as small as possible.
+
+Stream format, for each row:
+  row header: 0 = decoded row, 1 = raw row followed by 128 pixels
+  chunk decoded after the first scanline of the row
+  chunk decoded after the second scanline of the row
+The prepare function decodes one extra chunk before the first row. A chunk is a list of ops
+terminated by 0xff:
+  skip, length, pixels...		copy length (1-127) pixels after skipping skip (0-127) pixels
+  skip, 0x80 | length, color	fill length pixels with color
+The stream ends with a row header that is never shown.
+"""
+
+import os
+import sys
+
+WIDTH = 128
+HEIGHT = 80
+
+CHUNK_CYCLES = 170
+
+# decodeTitleChunk() cycle counts
+COPY_OP = 13
+COPY_PIXEL = 8
+FILL_OP = 18
+FILL_PIXEL = 5
+END_OP = 6
+
+MAX_OP_PIXELS = 127
+MAX_AHEAD = 8		# rows searched ahead for the next decoded row
+
+def read_pgm(path):
+	data = open(path, 'rb').read()
+	fields = data.split(None, 4)
+	if fields[0] != b'P5' or int(fields[1]) != WIDTH or int(fields[2]) != HEIGHT or int(fields[3]) != 255:
+		sys.exit('%s: expected a binary %dx%d PGM with maxval 255' % (path, WIDTH, HEIGHT))
+	pixels = fields[4][-WIDTH * HEIGHT:]
+	return [list(pixels[y * WIDTH:(y + 1) * WIDTH]) for y in range(HEIGHT)]
+
+def delta_ops(prev, row):
+	"""Cheapest list of (kind, start, end) ops turning prev into row."""
+	best = [0] * (WIDTH + 1)
+	choice = [None] * (WIDTH + 1)
+	for i in range(WIDTH - 1, -1, -1):
+		best[i] = 1 << 30
+		if prev[i] == row[i]:
+			best[i] = best[i + 1]
+			choice[i] = ('skip', i + 1)
+		fill = True
+		for j in range(i + 1, WIDTH + 1):
+			fill = fill and row[j - 1] == row[i]
+			c = COPY_OP + COPY_PIXEL * (j - i) + best[j]
+			if c < best[i]:
+				best[i] = c
+				choice[i] = ('copy', j)
+			if fill:
+				c = FILL_OP + FILL_PIXEL * (j - i) + best[j]
+				if c < best[i]:
+					best[i] = c
+					choice[i] = ('fill', j)
+	ops = []
+	i = 0
+	while i < WIDTH:
+		kind, j = choice[i]
+		if kind != 'skip':
+			ops.append((kind, i, j))
+		i = j
+	return ops
+
+def pack_chunks(ops, row, count):
+	"""Splits ops into count chunks of bytes that fit CHUNK_CYCLES, None if they do not fit."""
+	chunks = [[]]
+	cycles = END_OP
+	pos = 0
+	ops = list(ops)
+	while ops:
+		kind, start, end = ops.pop(0)
+		op, pixel = (COPY_OP, COPY_PIXEL) if kind == 'copy' else (FILL_OP, FILL_PIXEL)
+		n = min((CHUNK_CYCLES - cycles - op) // pixel, end - start, MAX_OP_PIXELS)
+		if n < 1:
+			if len(chunks) == count:
+				return None
+			chunks.append([])
+			cycles = END_OP
+			ops.insert(0, (kind, start, end))
+			continue
+		if start + n < end:
+			ops.insert(0, (kind, start + n, end))
+		chunk = chunks[-1]
+		chunk.append(start - pos)
+		if kind == 'copy':
+			chunk.append(n)
+			chunk.extend(row[start:start + n])
+		else:
+			chunk.append(0x80 | n)
+			chunk.append(row[start])
+		cycles += op + pixel * n
+		pos = start + n
+	chunks += [[]] * (count - len(chunks))
+	return [c + [0xff] for c in chunks]
+
+def pack(rows):
+	"""Returns {row: chunks} for the rows to decode, each with the chunks that lead to it."""
+	# best[t] = (size, previous decoded row, chunks) for the cheapest stream with row t decoded
+	# row -1 is the cleared linebuf before the first row
+	best = {-1: (0, None, None)}
+	for t in range(HEIGHT):
+		for p in range(max(-1, t - MAX_AHEAD), t):
+			if p not in best:
+				continue
+			prev = rows[p] if p >= 0 else [0] * WIDTH
+			count = 2 * (t - p) if p >= 0 else 1 + 2 * t
+			chunks = pack_chunks(delta_ops(prev, rows[t]), rows[t], count)
+			if chunks is None:
+				continue
+			size = best[p][0] + sum(len(c) for c in chunks) + (WIDTH + 1) * (t - p - 1) + 1
+			if t not in best or size < best[t][0]:
+				best[t] = (size, p, chunks)
+	last = min(best, key=lambda t: best[t][0] + (WIDTH + 1) * (HEIGHT - 1 - t))
+	decoded = {}
+	t = last
+	while t >= 0:
+		decoded[t] = best[t][2]
+		t = best[t][1]
+	return decoded
+
+def build_stream(rows, decoded):
+	"""Returns a list of (comment, bytes) records."""
+	chunks = []
+	for t in sorted(decoded):
+		chunks += decoded[t]
+	chunks += [[0xff]] * (1 + 2 * HEIGHT - len(chunks))
+
+	records = [('first chunk', chunks[0])]
+	for y in range(HEIGHT):
+		if y in decoded:
+			data, kind = [0], 'decoded'
+		else:
+			data, kind = [1] + rows[y], 'raw'
+		records.append(('row %d, %s' % (y, kind), data + chunks[1 + 2 * y] + chunks[2 + 2 * y]))
+	records.append(('end', [0]))
+	return records
+
+def verify(rows, stream):
+	"""Runs the stream like the scanline routines do and checks every shown row."""
+	bufs = [[0] * WIDTH, [0] * WIDTH]
+	show, target = 0, 1
+	pos = 0
+	dst = 0
+
+	def decode_chunk():
+		nonlocal pos, dst
+		while stream[pos] != 0xff:
+			dst += stream[pos]
+			n = stream[pos + 1]
+			pos += 2
+			if n & 0x80:
+				bufs[target][dst:dst + (n & 0x7f)] = [stream[pos]] * (n & 0x7f)
+				dst += n & 0x7f
+				pos += 1
+			else:
+				bufs[target][dst:dst + n] = stream[pos:pos + n]
+				dst += n
+				pos += n
+		pos += 1
+
+	decode_chunk()
+	for y in range(HEIGHT):
+		if stream[pos]:
+			shown = stream[pos + 1:pos + 1 + WIDTH]
+			pos += 1 + WIDTH
+		else:
+			show, target = target, show
+			bufs[target] = list(bufs[show])
+			dst = 0
+			shown = bufs[show]
+			pos += 1
+		if list(shown) != rows[y]:
+			sys.exit('row %d does not decode correctly' % y)
+		decode_chunk()
+		decode_chunk()
+
+def main():
+	root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+	src = sys.argv[1] if len(sys.argv) > 1 else os.path.join(root, 'assets', 'titlescreen.pgm')
+	dst = sys.argv[2] if len(sys.argv) > 2 else os.path.join(root, 'titlescreen.h')
+
+	rows = read_pgm(src)
+	records = build_stream(rows, pack(rows))
+	stream = [b for _, data in records for b in data]
+	verify(rows, stream)
+
+	raw = sum(1 for comment, _ in records if comment.endswith('raw'))
+	with open(dst, 'w') as f:
+		f.write('// titlescreen, %dx%d pixels packed by tools/titlepack.py from assets/titlescreen.pgm, do not edit\n' % (WIDTH, HEIGHT))
+		f.write('// %d bytes, %d rows stored raw, see titlepack.py for the format\n' % (len(stream), raw))
+		f.write('\n')
+		f.write('#define TITLESCREEN_CHUNK_CYCLES\t%d\n' % CHUNK_CYCLES)
+		f.write('\n')
+		f.write('PROGMEM prog_uchar titlescreen[] = {\n')
+		for comment, data in records:
+			f.write('\t%s,\t// %s\n' % (','.join('0x%02x' % b for b in data), comment))
+		f.write('};\n')
+
+	print('%s: %d bytes (%d raw), %d rows stored raw' % (dst, len(stream), WIDTH * HEIGHT, raw))
+
+if __name__ == '__main__':
+	main()
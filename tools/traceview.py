@@ -0,0 +1,165 @@
+#!/usr/bin/env python3
+"""Latency distributions and a timeline from the trace markers logged by sim/tqtrace.
+
+Usage: traceview.py [--timeline first[:count]] [--chrome out.json] trace.csv
+
+Begin and end markers are paired per source (main loop or video interrupt), nested markers are allowed.
+For every event the report gives the number of occurrences and the distribution of their length in cycles
+and scanlines. Events that carry a value (TRACE_VALUE, e.g. the room of TRACE_ROOM) are also broken down by
+value.
+
+--timeline draws the given frames as text, one row per source and frame, each character is 4 scanlines and
+shows the innermost event running at its start. --chrome writes the events in the Chrome trace format, which
+chrome://tracing and Perfetto show as a zoomable timeline.
+
+Event names come from the TRACE_ defines in trace.h.
+"""
+
+import csv
+import json
+import os
+import re
+import sys
+
+ROOT = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), '..'))
+
+LINE_CYCLES = 1016
+FRAME_LINES = 263
+LINES_PER_CHAR = 4
+CPU_MHZ = 16
+
+def read_names():
+	names = {}
+	for line in open(os.path.join(ROOT, 'trace.h')):
+		m = re.match(r'#define\s+TRACE_(\w+)\s+(\d+)\b', line)
+		if m and m.group(1) != 'END_BIT':
+			names[int(m.group(2))] = m.group(1).lower()
+	return names
+
+def read_spans(path, names):
+	"""Returns (spans, unmatched), spans are dicts sorted by start cycle."""
+	spans = []
+	open_spans = {'main': [], 'isr': []}
+	unmatched = 0
+	for row in csv.DictReader(open(path)):
+		source = row['source']
+		event = int(row['event'])
+		if row['phase'] == 'B':
+			open_spans[source].append({
+				'name': names.get(event, 'event%d' % event), 'source': source, 'value': int(row['value'] or 0),
+				'start': int(row['cycle']), 'frame': int(row['frame']), 'line': int(row['line']),
+				'depth': len(open_spans[source])})
+		else:
+			stack = open_spans[source]
+			name = names.get(event, 'event%d' % event)
+			# an end without its begin (the trace started inside it) is dropped with whatever it would close
+			i = len(stack) - 1
+			while i >= 0 and stack[i]['name'] != name:
+				i -= 1
+			if i < 0:
+				unmatched += 1
+				continue
+			unmatched += len(stack) - 1 - i
+			span = stack[i]
+			del stack[i:]
+			span['end'] = int(row['cycle'])
+			spans.append(span)
+	spans.sort(key=lambda s: s['start'])
+	return spans, unmatched
+
+def percentile(values, p):
+	return values[min(len(values) - 1, int(len(values) * p / 100))]
+
+def report(spans, frames):
+	print('%-16s %-4s %7s %8s %8s %8s %8s %8s %7s %7s' % ('event', 'src', 'count', 'min', 'median', 'p90', 'p99',
+		'max', 'maxline', 'cyc/frm'))
+	groups = {}
+	for s in spans:
+		groups.setdefault((s['source'], s['name']), []).append(s)
+	for (source, name), group in sorted(groups.items(), key=lambda g: -sum(s['end'] - s['start'] for s in g[1])):
+		lengths = sorted(s['end'] - s['start'] for s in group)
+		print('%-16s %-4s %7d %8d %8d %8d %8d %8d %7.1f %7.0f' % (name, source, len(lengths), lengths[0],
+			percentile(lengths, 50), percentile(lengths, 90), percentile(lengths, 99), lengths[-1],
+			lengths[-1] / LINE_CYCLES, sum(lengths) / max(frames, 1)))
+
+		values = sorted(set(s['value'] for s in group))
+		if len(values) > 1:
+			for v in values:
+				vl = sorted(s['end'] - s['start'] for s in group if s['value'] == v)
+				print('  value %-8d %7d %8d %8d %8d %8d %8d %7.1f' % (v, len(vl), vl[0], percentile(vl, 50),
+					percentile(vl, 90), percentile(vl, 99), vl[-1], vl[-1] / LINE_CYCLES))
+
+def timeline(spans, first, count, frame_start):
+	"""frame_start maps frame to the cycle of its buffer swap."""
+	letters = {}
+	for s in spans:
+		if s['name'] not in letters:
+			letters[s['name']] = chr(ord('a') + len(letters)) if len(letters) < 26 else '?'
+	width = (FRAME_LINES + LINES_PER_CHAR - 1) // LINES_PER_CHAR
+
+	print('each character is %d scanlines from the buffer swap, . is idle' % LINES_PER_CHAR)
+	for frame in range(first, first + count):
+		if frame not in frame_start:
+			break
+		base = frame_start[frame]
+		for source in ('main', 'isr'):
+			row = ['.'] * width
+			depth = [-1] * width
+			for s in spans:
+				if s['source'] != source or s['end'] < base or s['start'] >= base + FRAME_LINES * LINE_CYCLES:
+					continue
+				for c in range(width):
+					t = base + c * LINES_PER_CHAR * LINE_CYCLES
+					if s['start'] <= t < s['end'] and s['depth'] > depth[c]:
+						row[c] = letters[s['name']]
+						depth[c] = s['depth']
+			print('%6d %-4s %s' % (frame, source, ''.join(row)))
+	print(' '.join('%s=%s' % (l, n) for n, l in letters.items()))
+
+def chrome_trace(spans, path):
+	events = []
+	for s in spans:
+		events.append({'name': s['name'], 'ph': 'X', 'pid': 0, 'tid': s['source'], 'ts': s['start'] / CPU_MHZ,
+			'dur': (s['end'] - s['start']) / CPU_MHZ, 'args': {'value': s['value'], 'frame': s['frame'],
+			'line': s['line']}})
+	json.dump({'traceEvents': events, 'displayTimeUnit': 'ms'}, open(path, 'w'))
+
+def main():
+	args = sys.argv[1:]
+	first = count = None
+	chrome = None
+	while len(args) > 1 and args[0] in ('--timeline', '--chrome'):
+		if args[0] == '--timeline':
+			parts = args[1].split(':')
+			first = int(parts[0])
+			count = int(parts[1]) if len(parts) > 1 else 1
+		else:
+			chrome = args[1]
+		args = args[2:]
+	if len(args) != 1:
+		sys.exit(__doc__)
+
+	names = read_names()
+	spans, unmatched = read_spans(args[0], names)
+	if not spans:
+		sys.exit('%s: no complete events' % args[0])
+
+	# the swap is at line 0 of a frame, so the first marker seen in a frame dates it
+	frame_start = {}
+	for row in csv.DictReader(open(args[0])):
+		frame = int(row['frame'])
+		if frame not in frame_start:
+			frame_start[frame] = int(row['cycle']) - int(row['line']) * LINE_CYCLES
+	frames = max(frame_start) - min(frame_start) + 1
+
+	print('%d events in %d frames%s' % (len(spans), frames,
+		', %d markers without a partner' % unmatched if unmatched else ''))
+	report(spans, frames)
+	if first is not None:
+		print()
+		timeline(spans, first, count, frame_start)
+	if chrome:
+		chrome_trace(spans, chrome)
+
+if __name__ == '__main__':
+	main()
@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+"""Compares a reference audio render with a capture from the simulator, bit for bit.
+
+Usage: wavcmp.py reference.wav capture.wav
+
+The reference comes from host/tqaudio and the capture from sim/tqaudiocap, both 8 bit mono at the
+scanline rate with 263 samples per frame. The capture starts at power up, so it is aligned by finding
+the first frame of the reference that is not silent in it. Everything after that must match until one
+of the files ends. Exits with 1 and reports the first mismatching sample otherwise.
+"""
+
+import sys
+import wave
+
+FRAME_SAMPLES = 263
+
+def read(path):
+	w = wave.open(path, 'rb')
+	if w.getsampwidth() != 1 or w.getnchannels() != 1:
+		sys.exit('%s: expected 8 bit mono' % path)
+	return w.readframes(w.getnframes())
+
+def main():
+	if len(sys.argv) != 3:
+		sys.exit(__doc__)
+	ref = read(sys.argv[1])
+	cap = read(sys.argv[2])
+
+	# align on the first frame with sound, silence is all the same sample
+	for start in range(0, len(ref) - FRAME_SAMPLES + 1, FRAME_SAMPLES):
+		window = ref[start:start + FRAME_SAMPLES]
+		if window.count(window[0]) != len(window):
+			break
+	else:
+		sys.exit('%s: reference is silent' % sys.argv[1])
+
+	pos = cap.find(window)
+	if pos < 0:
+		sys.exit('frame %d of the reference does not appear in the capture' % (start // FRAME_SAMPLES))
+	offset = pos - start
+	if offset < 0:
+		sys.exit('capture starts in the middle of the reference')
+
+	n = min(len(ref), len(cap) - offset)
+	for i in range(n):
+		if ref[i] != cap[offset + i]:
+			print('mismatch at reference sample %d (frame %d, sample %d): reference %d, capture %d' %
+				(i, i // FRAME_SAMPLES, i % FRAME_SAMPLES, ref[i], cap[offset + i]))
+			diffs = sum(1 for j in range(i, n) if ref[j] != cap[offset + j])
+			print('%d of %d compared samples differ' % (diffs, n))
+			sys.exit(1)
+
+	print('%d samples (%d frames) match, reference starts at capture sample %d' % (n, n // FRAME_SAMPLES, offset))
+
+if __name__ == '__main__':
+	main()
@@ -27,29 +27,33 @@
 #define SHOW_TITLESCREEN
 #define ENABLE_SOUND
 #define ENABLE_MUSIC
-//#define DEBUG_SCANLINES
+//#define DEBUG_PROFILE			// show scanlines spent in each stage of the main loop in place of score and time, see profile.h
+//#define DEBUG_JITTER			// histogram of scanline interrupt entry times, on the last profiler page with DEBUG_PROFILE
+//#define DEBUG_TRACE			// write trace markers to the GPIOR registers for sim/tqtrace, see trace.h
+//#define DEBUG_TILES			// show the tile sheet 16 tiles wide with sprites walking over it instead of the game
 
+// tile indices, generated by tools/tilepack.py from assets/tiles.txt
 #define TILE_EMPTY				0
 #define TILE_PLAYER_LEFT		1		// tiles 1-5
 #define TILE_DOOR				6
 #define TILE_SPIKES				7
 #define TILE_PLAYER_RIGHT		8		// tiles 8-12
-#define TILE_HEART				13
-#define TILE_HEART_HALF			14
-#define TILE_HEART_BIG			15
-#define TILE_WALL				16
-#define TILE_PRINCESS			17		// tiles 17-18
-#define TILE_LADDER				19
-#define TILE_PLAYER_CLIMBING	20		// tiles 20-21
-#define TILE_KEY				22
-#define TILE_GHOST_LEFT			23		// tiles 23-24
-#define TILE_GHOST_RIGHT		25		// tiles 25-26
-#define TILE_GOLD				27		// tiles 27-28
-#define TILE_WYVERN				29		// tiles 29-30
-#define TILE_WALL_DARK			31
-#define TILE_WYVERN_2ND			32		// wyvern (sprite index 1)
-#define TILE_GHOST_LEFT_2ND		33		// ghost (sprite index 2)
+#define TILE_HEART				13		// tiles 13-14
+#define TILE_WALL				15
+#define TILE_PRINCESS			16		// tiles 16-17
+#define TILE_LADDER				18
+#define TILE_PLAYER_CLIMBING	19		// tiles 19-20
+#define TILE_KEY				21
+#define TILE_GHOST_LEFT			22		// tiles 22-23
+#define TILE_GHOST_RIGHT		24		// tiles 24-25
+#define TILE_GOLD				26		// tiles 26-27
+#define TILE_WYVERN				28		// tiles 28-29
+#define TILE_WALL_DARK			30
+#define TILE_WYVERN_2ND			31		// wyvern (sprite index 1)
+#define TILE_GHOST_LEFT_2ND		32		// ghost (sprite index 2)
+// end of tile indices
 
 #define TIME_SPEEDUP			30
+#define FRAMES_PER_TICK			2		// game runs at 30 hz, audio is mixed every frame
 
 #endif
@@ -0,0 +1,77 @@
+/*
+ Toorum's Quest II
+ Copyright (c) 2013 Petri Hakkinen
+ 
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions: 
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+*/
+
+// Trace markers for DEBUG_TRACE builds, timestamped by sim/tqtrace and analyzed by tools/traceview.py
+//
+// PORTD is the video DAC, so there is no serial port to print to. Instead, markers write an event to one of
+// the general purpose I/O registers, which do nothing on the chip. Each marker is an out instruction plus the
+// ldi of its constant: 2 cycles, and it needs no RAM. The main loop writes GPIOR0 and code run by the video
+// interrupt writes GPIOR1, so the analyzer can tell them apart and nesting never mixes the two. TRACE_VALUE
+// stores a byte in GPIOR2 that is logged with the next begin marker, e.g. the room being loaded.
+//
+// Without DEBUG_TRACE the macros are empty. The event names are read from this file by the analyzer.
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "tq.h"
+
+// main loop, GPIOR0
+#define TRACE_TICK				1		// updateGame
+#define TRACE_CONTROLLER		2
+#define TRACE_COMMIT_WAIT		3		// updateGame waiting for the room commit
+#define TRACE_PLAYER			4
+#define TRACE_TILES				5
+#define TRACE_ENEMIES			6
+#define TRACE_HUD				7
+#define TRACE_MIX				8
+#define TRACE_MUSIC				9
+#define TRACE_ROOM				10		// initRoom, value is the room
+#define TRACE_SLEEP				11		// waitForVBlank sleeping
+
+// video interrupt, GPIOR1
+#define TRACE_ROOM_COMMIT		32		// commitRoom
+#define TRACE_SCORE_COMMIT		33		// commitScoreBar
+#define TRACE_SPRITE_EXPAND		34		// expandSprites
+
+#define TRACE_END_BIT			0x80
+
+#ifdef DEBUG_TRACE
+
+#define TRACE_BEGIN(id)			(GPIOR0 = (id))
+#define TRACE_END(id)			(GPIOR0 = (id) | TRACE_END_BIT)
+#define TRACE_ISR_BEGIN(id)		(GPIOR1 = (id))
+#define TRACE_ISR_END(id)		(GPIOR1 = (id) | TRACE_END_BIT)
+#define TRACE_VALUE(v)			(GPIOR2 = (v))
+
+#else
+
+#define TRACE_BEGIN(id)
+#define TRACE_END(id)
+#define TRACE_ISR_BEGIN(id)
+#define TRACE_ISR_END(id)
+#define TRACE_VALUE(v)
+
+#endif
+
+#endif
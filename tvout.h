@@ -93,4 +93,23 @@ void inline wait_until(uint8_t time) {
 	);
 }
 
+// like wait_until() but reads TCNT1L itself, for kernels that must output their first pixel on an exact
+// cycle no matter how gcc loads their operands; ends 8 cycles after TCNT1L reaches [delay]
+// uses r16 and r17, TCNT1L must not be past the delay yet
+#define WAIT_OUTPUT_START \
+		"lds	r16, %[tcnt1l]\n\t" \
+		"ldi	r17, %[delay]\n\t" \
+		"sub	r17, r16\n\t" \
+	"1:\n\t" \
+		"subi	r17, 3\n\t" \
+		"brcc	1b\n\t" \
+		"subi	r17, 0-3\n\t" \
+		"breq	2f\n\t" \
+		"dec	r17\n\t" \
+		"breq	3f\n\t" \
+		"rjmp	3f\n" \
+	"2:\n\t" \
+		"nop\n" \
+	"3:\n\t"
+
 #endif
@@ -24,25 +24,108 @@
 #include <arduino.h>
 #include <avr/interrupt.h>
 #include <avr/io.h>
+#include <avr/sleep.h>
 #include "videogen.h"
 #include "tq.h"
+#include "trace.h"
 #include "audio.h"
 
 #define LINES_PER_FRAME		_NTSC_LINE_FRAME
 #define VSYNC_END			_NTSC_LINE_STOP_VSYNC
-#define OUTPUT_DELAY		_NTSC_CYCLES_OUTPUT_START
+#define CYCLES_PER_LINE		((uint16_t)_NTSC_CYCLES_SCANLINE)
 
 #ifdef SHOW_TITLESCREEN
 #include "titlescreen.h"
-void* titlescreenPtr = titlescreen;
+#if TITLESCREEN_CHUNK_CYCLES > TITLE_CHUNK_CYCLES
+#error titlescreen.h was packed for a larger decode budget, rerun tools/titlepack.py
+#endif
+const prog_uchar* titlescreenPtr = titlescreen;
 #else
-void* titlescreenPtr = 0;
+const prog_uchar* titlescreenPtr = 0;
 #endif
 
 volatile int scanLine;
-int renderLine;					// for titlescreen mode
+volatile uint8_t frameCounter;
 void (*interruptRoutine)();		// current scanline interrupt routine
-void (*videomode)();
+uint8_t isrSave;				// r0 is parked here while jumping to interruptRoutine
+
+#ifdef DEBUG_JITTER
+uint8_t isrEntry;
+uint16_t jitterCounts[JITTER_BINS];
+uint8_t jitterCountsMax;
+volatile uint16_t jitterHistogram[JITTER_BINS];
+volatile uint8_t jitterFrameMax;
+volatile uint8_t jitterMax;
+#endif
+int regionEnd;					// scanline where the current display list region ends
+
+static const DisplayRegion*	displayList;	// in flash
+static const DisplayRegion*	regionPtr;		// next region of the current frame
+static int					displayStart;	// blank line on which the first region is set up
+static uint8_t				syncFrame;		// frameCounter when waitForVBlank last returned
+static volatile uint8_t*	messageTiles[NUM_TILES_X+1];	// text row of VIDMODE_MESSAGE, the room stays in tmap
+															// the last glyph reads one entry ahead
+
+static inline void render_titlescreen(uint8_t* src, uint8_t* dst) __attribute__((always_inline));
+static inline void render_titlescreen_flash(const uint8_t* src) __attribute__((always_inline));
+static inline void decodeTitleChunk() __attribute__((always_inline));
+static inline void nextTitleRow() __attribute__((always_inline));
+template<uint8_t textTiles, uint8_t numTiles> static inline void render_tiles() __attribute__((always_inline));
+
+static void prepareIntro(uint8_t row);
+static void prepareMessage(uint8_t row);
+static void prepareTitlescreen(uint8_t row);
+
+// score bar is a tile only region, the playfield below it runs the sprite pipeline
+PROGMEM const DisplayRegion tilesAndSpritesList[] = {
+	{ prepareTiles, active_line_tiles, 0, 8*2 },
+	{ prepareTilesWithSprites, active_line_even, 1, (NUM_TILES_Y-1)*8*2 + 2 },
+	{ 0, 0, 0, 0 }
+};
+
+// game over and win message: the playfield is split around MESSAGE_ROW, which shows messageTiles as text
+// the text region is 7 glyph rows high, the 8th is blank for letters, so the rows below it move down 2 scanlines
+PROGMEM const DisplayRegion messageList[] = {
+	{ prepareTiles, active_line_tiles, 0, 8*2 },
+	{ prepareTilesWithSprites, active_line_even, 1, (MESSAGE_ROW-1)*8*2 + 2 },
+	{ prepareMessage, active_line_message, MESSAGE_ROW, 7*2 },
+	{ prepareTilesWithSprites, active_line_even, MESSAGE_ROW+1, (NUM_TILES_Y-1-MESSAGE_ROW)*8*2 + 2 },
+	{ 0, 0, 0, 0 }
+};
+
+// busy rooms show the playfield in low resolution, where every updateSprite call gets a sprite of its own
+PROGMEM const DisplayRegion lowresList[] = {
+	{ prepareTiles, active_line_tiles, 0, 8*2 },
+	{ prepareLowres, active_line_lowres_even, 1, (NUM_TILES_Y-1)*8*2 + 2 },
+	{ 0, 0, 0, 0 }
+};
+
+#ifdef DEBUG_TILES
+// tile sheet viewer, see videogen_wide.cpp
+PROGMEM const DisplayRegion wideList[] = {
+	{ prepareWide, active_line_wide_a, 0, WIDE_TILES_Y*8*3 + 3 },
+	{ 0, 0, 0, 0 }
+};
+#endif
+
+PROGMEM const DisplayRegion introList[] = {
+	{ prepareIntro, active_line_intro, 0, SCREEN_HEIGHT*2 },
+	{ 0, 0, 0, 0 }
+};
+
+PROGMEM const DisplayRegion titlescreenList[] = {
+	{ prepareTitlescreen, active_line_titlescreen, 0, SCREEN_HEIGHT*2 },
+	{ 0, 0, 0, 0 }
+};
+
+struct BlankTask {
+	void		(*func)();
+	uint16_t	cycles;			// worst case cycles including call overhead
+};
+
+static BlankTask	blankTasks[MAX_BLANK_TASKS];
+static volatile uint8_t	numBlankTasks;	// read by the video interrupt
+static uint8_t		nextBlankTask;	// round robin position
 
 void initScreen() {
 	// set pins 0-7 to output mode
@@ -61,10 +144,13 @@ void initScreen() {
 
 	OCR1A = _CYCLES_HORZ_SYNC;
 
+	// waitForVBlank sleeps between video interrupts, timers keep running in idle mode
+	set_sleep_mode(SLEEP_MODE_IDLE);
+
 	scanLine = LINES_PER_FRAME+1;
 	interruptRoutine = &vsync_line;
 
-	prepareTilesWithSprites();
+	initSprites();
 	setVideoMode(VIDMODE_TILES_AND_SPRITES);
 
 	TIMSK1 = _BV(TOIE1);
@@ -74,71 +160,244 @@ void initScreen() {
 void setVideoMode(uint8_t mode) {
 	switch(mode) {
 	case VIDMODE_TILES_AND_SPRITES:
-		videomode = active_line_even;
+		setDisplayList(tilesAndSpritesList, SCREEN_START);
 		break;
 
 	case VIDMODE_INTRO:
-		videomode = active_line_intro;
+		setDisplayList(introList, SCREEN_START);
 		break;
 
 	case VIDMODE_TITLESCREEN:
-		videomode = active_line_titlescreen;
+		setDisplayList(titlescreenList, SCREEN_START);
+		break;
+
+	case VIDMODE_MESSAGE:
+		setDisplayList(messageList, SCREEN_START);
+		break;
+
+	case VIDMODE_LOWRES:
+		setDisplayList(lowresList, SCREEN_START);
+		break;
+
+#ifdef DEBUG_TILES
+	case VIDMODE_WIDE:
+		setDisplayList(wideList, SCREEN_START);
 		break;
+#endif
+	}
+}
+
+void setDisplayList(const DisplayRegion* list, int startLine) {
+	uint8_t sreg = SREG;
+	cli();
+	displayList = list;
+	displayStart = startLine;
+	SREG = sreg;
+}
+
+void prepareTiles(uint8_t row) {
+	tmapPtr = &tmap[row * NUM_TILES_X];
+	tileOffset = 0;
+}
+
+static void prepareIntro(uint8_t row) {
+	tmapPtr = &tmap[row * 14];
+	tileOffset = 0;
+}
+
+static void prepareMessage(uint8_t row) {
+	tmapPtr = messageTiles;
+	tileOffset = 0;
+}
+
+// titlescreen rows are shown on two scanlines, either streamed from flash (raw rows) or from one half of linebuf
+// (decoded rows). The other half is the decode target, which is brought up to the next decoded row one chunk
+// at a time after the last pixel of every scanline. See tools/titlepack.py for the stream format.
+static const uint8_t*	titleStream;		// next chunk or row header
+static const uint8_t*	titleRaw;			// pixels of the current row in flash, 0 for a decoded row
+static uint8_t*			titleShow;			// current decoded row
+static uint8_t*			titleDst;			// decode position in the other half
+static bool				titleSecondLine;
+
+// the stream can only be decoded from the top, so the titlescreen always starts at its first row
+static void prepareTitlescreen(uint8_t row) {
+	titleStream = titlescreenPtr;
+	titleShow = linebuf;
+	titleDst = linebuf + TITLE_WIDTH;
+	titleSecondLine = false;
+
+	for(uint8_t i = 0; i < TITLE_WIDTH; i++)
+		titleDst[i] = 0;
+
+	decodeTitleChunk();
+	nextTitleRow();
+}
+
+// read the next row header, a decoded row is shown from the decode target and the other half becomes the target
+static void nextTitleRow() {
+	const uint8_t* p = titleStream;
+	if(pgm_read_byte(p++)) {
+		titleRaw = p;
+		p += TITLE_WIDTH;
+	} else {
+		titleRaw = 0;
+		uint8_t* row = (titleShow == linebuf ? linebuf + TITLE_WIDTH : linebuf);
+		titleDst = titleShow;	// gets a copy of the row on its first scanline
+		titleShow = row;
+	}
+	titleStream = p;
+}
+
+// set up the next region of the display list, or go blank when the list ends
+// the region's routine takes over from the next scanline
+static void startRegion() {
+	const DisplayRegion* r = regionPtr;
+	uint8_t lines = pgm_read_byte_near(&r->lines);
+	if(lines == 0) {
+		interruptRoutine = &blank_line;
+		return;
+	}
+	regionPtr = r + 1;
+
+	void (*setup)(uint8_t) = (void (*)(uint8_t))pgm_read_word_near(&r->setup);
+	setup(pgm_read_byte_near(&r->row));
+
+	regionEnd = scanLine + 1 + lines;
+	interruptRoutine = (void (*)())pgm_read_word_near(&r->routine);
+}
+
+bool addBlankTask(void (*func)(), uint16_t cycles) {
+	for(uint8_t i = 0; i < numBlankTasks; i++)
+		if(blankTasks[i].func == func)
+			return true;	// already registered
+
+	if(numBlankTasks == MAX_BLANK_TASKS || cycles > CYCLES_PER_LINE - BLANK_TASK_MARGIN)
+		return false;
+
+	// fill in the entry before publishing it to the interrupt, the barrier keeps the compiler from
+	// moving the stores to the entry past the count update
+	uint8_t n = numBlankTasks;
+	blankTasks[n].func = func;
+	blankTasks[n].cycles = cycles;
+	__asm__ __volatile__ ("" ::: "memory");
+	numBlankTasks = n + 1;
+	return true;
+}
+
+void removeBlankTask(void (*func)()) {
+	uint8_t sreg = SREG;
+	cli();
+	for(uint8_t i = 0; i < numBlankTasks; i++) {
+		if(blankTasks[i].func == func) {
+			numBlankTasks--;
+			for(; i < numBlankTasks; i++)
+				blankTasks[i] = blankTasks[i+1];
+			break;
+		}
 	}
+	SREG = sreg;
 }
 
-void waitForVBlank() {
-	int stop = (int)SCREEN_END+1;
-	while(scanLine != stop);
-	while(scanLine == stop);
+// run as many blank line tasks as fit in the remaining scanline, round robin
+static void runBlankTasks() {
+	for(uint8_t n = numBlankTasks; n > 0; n--) {
+		if(nextBlankTask >= numBlankTasks)
+			nextBlankTask = 0;
+		BlankTask* t = &blankTasks[nextBlankTask++];
+		if(TCNT1 + t->cycles <= CYCLES_PER_LINE - BLANK_TASK_MARGIN)
+			t->func();
+	}
+}
+
+uint8_t waitForVBlank() {
+	// the video interrupt wakes the cpu up every scanline
+	TRACE_BEGIN(TRACE_SLEEP);
+	sleep_enable();
+	while(frameCounter == syncFrame)
+		sleep_cpu();
+	sleep_disable();
+	TRACE_END(TRACE_SLEEP);
+
+	uint8_t frames = frameCounter - syncFrame;
+	syncFrame += frames;
+	return frames;
 }
 
 // video signal generation interrupt (timer1 interrupt)
 // this will be called every 63.55us (15735.64122738 Hz)
-ISR(TIMER1_OVF_vect) {
-#ifdef ENABLE_SOUND
-	// pull audio from buffer and feed to OCR2A
-	OCR2A = audioBufferReadPtr[scanLine-1];
+// jump to current scanline routine by pushing its address and returning to it, no registers or flags are touched
+// DEBUG_JITTER builds also store TCNT1L on entry, which delays every scanline routine by 4 cycles
+ISR(TIMER1_OVF_vect, ISR_NAKED) {
+	__asm__ __volatile__ (
+		"sts	isrSave, r0\n\t"					// 2c
+#ifdef DEBUG_JITTER
+		"lds	r0, %[tcnt1l]\n\t"				// 2c
+		"sts	isrEntry, r0\n\t"				// 2c
+#endif
+		"lds	r0, interruptRoutine\n\t"		// 2c
+		"push	r0\n\t"							// 2c
+		"lds	r0, interruptRoutine+1\n\t"		// 2c
+		"push	r0\n\t"							// 2c
+		"lds	r0, isrSave\n\t"					// 2c
+		"ret\n\t"								// 4c
+		:
+		: [tcnt1l] "n" (_SFR_MEM_ADDR(TCNT1L))
+	);
+}
+
+void blank_line() {
+	outputAudioSample();
 
 	// 440hz test tone
 	//static uint16_t phase = 0;
 	//phase += 1832; //65536 * 440 / 15735;
 	//OCR2A = phase < 32768 ? 255 : 0;
-#endif
 
-	interruptRoutine();
-}
-
-void blank_line() {
-	if(scanLine == SCREEN_START) {
-		renderLine = 0;
-		tmapPtr = tmap;
-		prepareTilesWithSprites();
-		interruptRoutine = videomode;
+	if(scanLine == displayStart) {
+		regionPtr = displayList;
+		startRegion();
 	}
 	else if(scanLine == LINES_PER_FRAME) {
 		interruptRoutine = &vsync_line;
 	}
 	
 	scanLine++;
+
+	runBlankTasks();
+}
+
+// black scanline between display list regions
+void region_line() {
+	outputAudioSample();
+	startRegion();
+	scanLine++;
 }
 
 void active_line_titlescreen() {
-	wait_until(OUTPUT_DELAY);
-	render_titlescreen();
+	outputAudioSample();
+
+	// the first scanline of a decoded row copies it to the decode target, the second one onto itself
+	if(titleRaw)
+		render_titlescreen_flash(titleRaw);
+	else
+		render_titlescreen(titleShow, titleSecondLine ? titleShow : titleDst);
+
+	// decode while the rest of this scanline and the start of the next one are black
+	decodeTitleChunk();
 
-	// advance to next row of pixels in titlescreen every other scanline
-	if(scanLine & 1)
-		renderLine += 128;
+	if(titleSecondLine)
+		nextTitleRow();
+	titleSecondLine = !titleSecondLine;
 
 	scanLine++;
-	if(scanLine == SCREEN_END)
-		interruptRoutine = &blank_line;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
 }
 
 void active_line_intro() {
+	outputAudioSample();
 	wait_until(OUTPUT_DELAY);
-	render_tiles_14();
+	render_tiles<14, 0>();
 
 	// advance to next row every other scanline
 	if(scanLine & 1) {
@@ -151,54 +410,68 @@ void active_line_intro() {
 	}
 
 	scanLine++;
-	if(scanLine == SCREEN_END)
-		interruptRoutine = &blank_line;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
 }
 
-void active_line_even() {
+// 13 tiles wide tile only mode for the score bar
+void active_line_tiles() {
+	outputAudioSample();
 	wait_until(OUTPUT_DELAY);
-	render_tiles_with_sprites_even();
+	render_tiles<HUD_TEXT_TILES, NUM_TILES_X - HUD_TEXT_TILES>();
 
-	interruptRoutine = &active_line_odd;
+	// advance to next row of pixels every other scanline, regions are an even number of lines high
+	if((regionEnd - scanLine) & 1) {
+		tileOffset = (tileOffset + 8) & (7*8);
+		if(tileOffset == 0)
+			tmapPtr += NUM_TILES_X;
+	}
 
 	scanLine++;
-	if(scanLine == SCREEN_END)
-		interruptRoutine = &blank_line;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
 }
 
-void active_line_odd() {
+// 13 glyphs wide text row over the playfield, the region is a single row of glyphs
+void active_line_message() {
+	outputAudioSample();
 	wait_until(OUTPUT_DELAY);
-	render_tiles_with_sprites_odd();
+	render_tiles<NUM_TILES_X, 0>();
 
-	// advance to next row of pixels in tiles
-	tileOffset = (tileOffset + 8) & (7*8);
-	if(tileOffset == 0)
-		tmapPtr += NUM_TILES_X;	// advance to next row of tiles
-
-	// swap line buffer
-	uint8_t* tmp = linebuf1;
-	linebuf1 = linebuf2;
-	linebuf2 = tmp;
-
-	interruptRoutine = &active_line_even;
+	// advance to next row of pixels every other scanline
+	if((regionEnd - scanLine) & 1)
+		tileOffset += 8;
 
 	scanLine++;
-	if(scanLine == SCREEN_END)
-		interruptRoutine = &blank_line;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
 }
 
 void vsync_line() {
+	outputAudioSample();
+
 	if(scanLine >= LINES_PER_FRAME) {
 		OCR1A = _CYCLES_VIRT_SYNC;
 		scanLine = 0;
 
-		for(int i = 0; i < SCREEN_WIDTH; i++)
-			linebuf2[i] = 0;
-
 		// swap audio buffers
 		volatile uint8_t* tmp = audioBufferReadPtr;
 		audioBufferReadPtr = audioBufferWritePtr;
 		audioBufferWritePtr = tmp;
+		frameCounter++;
+
+#ifdef DEBUG_JITTER
+		for(uint8_t i = 0; i < JITTER_BINS; i++) {
+			jitterHistogram[i] = jitterCounts[i];
+			jitterCounts[i] = 0;
+		}
+		jitterFrameMax = jitterCountsMax;
+		if(jitterCountsMax > jitterMax)
+			jitterMax = jitterCountsMax;
+		jitterCountsMax = 0;
+#endif
+
+		swapSprites();
 	}
 	else if(scanLine == VSYNC_END) {
 		OCR1A = _CYCLES_HORZ_SYNC;
@@ -207,32 +480,169 @@ void vsync_line() {
 	scanLine++;
 }
 
-void render_titlescreen() {
+// WAIT_OUTPUT_START ends 8 cycles after TCNT1L reaches the delay and both kernels output their first pixel
+// 4 cycles later
+#define TITLE_SYNC_DELAY		((uint8_t)(OUTPUT_DELAY - 12))
+
+// output a decoded row from linebuf and copy it to dst
+static void render_titlescreen(uint8_t* src, uint8_t* dst) {
 	__asm__ __volatile__ (
-		// Z = Z + Y
-		"add	r30,r28\n\t"
-		"adc	r31,r29\n\t"
+		// X = src
+		// Y = dst
+
+		WAIT_OUTPUT_START
+		"nop\n\t"							// same start as the flash kernel
 
 		// output 128 pixels
 	".rept 128\n\t"
-		"lpm	r16, Z+\n\t"
-		"out	%[port],r16\n\t"
+		"ld		r16, X+\n\t"		// 2c
+		"out	%[port], r16\n\t"	// 1c
+		"st		Y+, r16\n\t"		// 2c
+	".endr\n\t"
+
+		// black
+		"out	%[port], r1\n\t"
+
+		: "+x" (src), "+y" (dst)
+		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
+		[tcnt1l] "n" (_SFR_MEM_ADDR(TCNT1L)),
+		[delay] "n" (TITLE_SYNC_DELAY)
+		: "r16", "r17" // clobbered registers
+	);
+}
+
+// output a raw row from flash
+static void render_titlescreen_flash(const uint8_t* src) {
+	__asm__ __volatile__ (
+		// Z = src
+
+		WAIT_OUTPUT_START
+
+		// output 128 pixels
+	".rept 128\n\t"
+		"lpm	r16, Z+\n\t"		// 3c
+		"out	%[port], r16\n\t"	// 1c
 		"nop\n\t"
 	".endr\n\t"
 
 		// black
-		"ldi	r16, 0\n\t"
-		"out	%[port],r16\n\t"
+		"nop\n\t"
+		"out	%[port], r1\n\t"
 
-		:
+		: "+z" (src)
 		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
-		"y" (renderLine),
-		"z" (titlescreenPtr)
+		[tcnt1l] "n" (_SFR_MEM_ADDR(TCNT1L)),
+		[delay] "n" (TITLE_SYNC_DELAY)
 		: "r16", "r17" // clobbered registers
 	);
 }
 
-void render_tiles_14() {
+// apply one chunk of the title stream to the decode target
+// copies cost 13+8n cycles and fills 18+5n, tools/titlepack.py keeps a chunk within TITLE_CHUNK_CYCLES:
+// the last pixel is out at about 830 and the next line must read TCNT1L before TITLE_SYNC_DELAY,
+// which leaves about 190 cycles after the interrupt entry and exit overhead
+static void decodeTitleChunk() {
+	const uint8_t* src = titleStream;
+	uint8_t* dst = titleDst;
+	__asm__ __volatile__ (
+		// Z = stream
+		// Y = decode position
+
+	"1:\n\t"
+		"lpm	r16, Z+\n\t"		// skip, 0xff ends the chunk
+		"cpi	r16, 0xff\n\t"
+		"breq	4f\n\t"
+		"add	r28, r16\n\t"
+		"adc	r29, r1\n\t"
+		"lpm	r16, Z+\n\t"		// length, bit 7 set for a fill
+		"sbrc	r16, 7\n\t"
+		"rjmp	3f\n\t"
+
+		// copy pixels, 8 cycles per pixel
+	"2:\n\t"
+		"lpm	r0, Z+\n\t"
+		"st		Y+, r0\n\t"
+		"dec	r16\n\t"
+		"brne	2b\n\t"
+		"rjmp	1b\n\t"
+
+		// fill pixels, 5 cycles per pixel
+	"3:\n\t"
+		"andi	r16, 0x7f\n\t"
+		"lpm	r0, Z+\n\t"
+	"5:\n\t"
+		"st		Y+, r0\n\t"
+		"dec	r16\n\t"
+		"brne	5b\n\t"
+		"rjmp	1b\n\t"
+	"4:\n\t"
+
+		: "+z" (src), "+y" (dst)
+		:
+		: "r0", "r16" // clobbered registers
+	);
+	titleStream = src;
+	titleDst = dst;
+}
+
+// output 8 pixels of a 1bpp glyph row from r16 and fetch the next row to r16
+// bits are expanded to [fg] or black with sbc, which leaves 2 free cycles per pixel for the fetch
+// X = tmap, the next tile address is offset by nextOffset
+#define TEXT_GLYPH_8_PIXELS(nextOffset) \
+		"lsl	r16\n\t"			/* next pixel to carry, 1c */ \
+		"sbc	r17, r17\n\t"		/* 0xff if set, 1c */ \
+		"and	r17, %[fg]\n\t"		/* 1c */ \
+		"ld		r18, X+\n\t"		/* preload next glyph (lo), 2c */ \
+		"out	%[port], r17\n\t"	/* 1c */ \
+		\
+		"lsl	r16\n\t" \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"ld		r19, X+\n\t"		/* preload next glyph (hi), 2c */ \
+		"out	%[port], r17\n\t" \
+		\
+		"lsl	r16\n\t" \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"add	r18, " nextOffset "\n\t"	/* 1c */ \
+		"adc	r19, r1\n\t"		/* 1c */ \
+		"out	%[port], r17\n\t" \
+		\
+		"lsl	r16\n\t" \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"movw	r30, r18\n\t"		/* 1c */ \
+		"lsl	r16\n\t"			/* carry is kept for the next pixel, 1c */ \
+		"out	%[port], r17\n\t" \
+		\
+		"lpm	r20, Z\n\t"			/* next glyph row, 3c */ \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"out	%[port], r17\n\t" \
+		\
+		"lsl	r16\n\t" \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"nop\n\t" \
+		"nop\n\t" \
+		"out	%[port], r17\n\t" \
+		\
+		"lsl	r16\n\t" \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"nop\n\t" \
+		"nop\n\t" \
+		"out	%[port], r17\n\t" \
+		\
+		"lsl	r16\n\t" \
+		"sbc	r17, r17\n\t" \
+		"and	r17, %[fg]\n\t" \
+		"mov	r16, r20\n\t"		/* 1c */ \
+		"nop\n\t" \
+		"out	%[port], r17\n\t"
+
+// textTiles 1bpp glyphs followed by numTiles tiles, text regions keep tileOffset in tile units too
+template<uint8_t textTiles, uint8_t numTiles> static void render_tiles() {
 	__asm__ __volatile__ (
 		"movw	r26, r28\n\t"	// X=Y
 		// X=r27:r26, Y=r29:r28, Z=r31:r30
@@ -240,15 +650,26 @@ void render_tiles_14() {
 		// load first tile 
 		"ld		r30, X+\n\t"		// 2
 		"ld		r31, X+\n\t"		// 2
-		// Z = Z + Y
-		//"add	r30,r28\n\t"
-		//"adc	r31,r29\n\t"
+	".if %[textTiles]\n\t"
+		"add	r30, %[row]\n\t"	// Z = Z + glyph row, 1c
+		"adc	r31, r1\n\t"		// 1c
+		"lpm	r16, Z\n\t"			// 3c
+	".else\n\t"
 		"add	r30, %[tileOffset]\n\t"	// Z = Z + offset, 1c
 		"adc	r31, r1\n\t"		// 1c
+	".endif\n\t"
 
-		// do 14 tiles
+		// do textTiles glyphs, the last one fetches the first tile
+	".if %[textTiles]\n\t"
+	".rept %[textTiles]-1\n\t"
+		TEXT_GLYPH_8_PIXELS("%[row]")
+	".endr\n\t"
+		TEXT_GLYPH_8_PIXELS("%[tileOffset]")
+	".endif\n\t"
+
+		// do numTiles tiles
 		// 6 cycles per pixel
-	".rept 14\n\t"
+	".rept %[numTiles]\n\t"
 		"lpm	r16, Z+\n\t"		// 3c
 		"ld		r18, X+\n\t"		// preload next tile (lo), 2c
 		"out	%[port],r16\n\t"	// 1c
@@ -301,35 +722,42 @@ void render_tiles_14() {
 		:
 		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
 		"y" (tmapPtr),
-		[tileOffset] "r" (tileOffset)
-		: "r16", "r17", "r18", "r19", "r26", "r27", "r30", "r31" // clobbered registers
+		[tileOffset] "r" (tileOffset),
+		[row] "r" ((uint8_t)(tileOffset >> 3)),
+		[fg] "r" ((uint8_t)TEXT_COLOR),
+		[textTiles] "n" (textTiles),
+		[numTiles] "n" (numTiles)
+		: "r16", "r17", "r18", "r19", "r20", "r26", "r27", "r30", "r31" // clobbered registers
 	);
 }
 
-PROGMEM const prog_char charset[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZ!&'(),-.0123456789?";
-
 void clearScreen() {
 	for(uint8_t i = 0; i < NUM_TILES_X*NUM_TILES_Y; i++)
-		setTile(i, 0);
+		setGlyph(i, GLYPH_SPACE);
 }
 
-void drawText(uint8_t x, uint8_t y, const char* text) {
+void drawText(uint8_t x, uint8_t y, const prog_uchar* text) {
 	uint8_t ox = x;
-	while(*text != 0) {
-		if(x < NUM_TILES_X && y < NUM_TILES_Y) // && *text != ' ')
-			setTile(x, y, charToTile(*text));
-		x++;
-		if(*text == '\n') {
+	uint8_t glyph;
+	while((glyph = pgm_read_byte_near(text++)) != GLYPH_END) {
+		if(glyph == GLYPH_NEWLINE) {
 			x = ox;
 			y++;
+			continue;
 		}
-		text++;
+		if(x < NUM_TILES_X && y < NUM_TILES_Y)
+			setGlyph(y * NUM_TILES_X + x, glyph);
+		x++;
 	}
 }
 
-uint8_t charToTile(uint8_t ch) {
-	for(uint8_t i = 0; i < sizeof(charset); i++)
-		if(pgm_read_byte_near(charset + i) == ch)
-			return 32 + i;
-	return 0;
+void showMessage(uint8_t x, const prog_uchar* text) {
+	for(uint8_t i = 0; i < NUM_TILES_X; i++)
+		messageTiles[i] = &font[GLYPH_SPACE * 8];
+
+	uint8_t glyph;
+	while((glyph = pgm_read_byte_near(text++)) != GLYPH_END && x < NUM_TILES_X)
+		messageTiles[x++] = &font[glyph * 8];
+
+	setVideoMode(VIDMODE_MESSAGE);
 }
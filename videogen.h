@@ -26,6 +26,8 @@
 
 #include <arduino.h>
 #include "tvout.h"
+#include "tq.h"
+#include "audio.h"
 
 #define NUM_TILES_X					13
 #define NUM_TILES_Y					10
@@ -34,62 +36,254 @@
 #define SCREEN_HEIGHT				(NUM_TILES_Y*8)
 
 #define SCREEN_START				59
-#define SCREEN_END					(SCREEN_START+SCREEN_HEIGHT*2)	// exclusive
+
+#define OUTPUT_DELAY				_NTSC_CYCLES_OUTPUT_START
+#define SCANLINE_CYCLES				1016	// _NTSC_CYCLES_SCANLINE + 1 as an integer for #if
+
+// scanline routine timing for the render kernels' compile time checks, counted from the instructions
+// entry: interrupt response and the vector's jmp (7), the dispatch interrupt (16) and up to 5 more while the main
+// loop finishes an instruction or wakes up, then gcc's prologue saving r0, r1, SREG and at most r16-r31 (40)
+// exit: the epilogue restoring them and reti
+#ifdef DEBUG_JITTER
+#define SCANLINE_ENTRY_CYCLES		(7 + 20 + 5 + 40)
+#define JITTER_COUNT_CYCLES			34		// countJitter
+#else
+#define SCANLINE_ENTRY_CYCLES		(7 + 16 + 5 + 40)
+#define JITTER_COUNT_CYCLES			0
+#endif
+#define SCANLINE_EXIT_CYCLES		(16*2 + 7 + 4)
+#define AUDIO_SAMPLE_CYCLES			16		// outputAudioSample without the jitter count
+#define WAIT_UNTIL_LEAD				12		// wait_until reads TCNT1L after 2 cycles and needs 10 more before the time
+
+// cycles from a routine's timer overflow until its wait_until(OUTPUT_DELAY) has read TCNT1L with time to spare,
+// 'before' is the code between outputAudioSample(false) and the wait
+#define LINE_START_CYCLES(before)	(SCANLINE_ENTRY_CYCLES + AUDIO_SAMPLE_CYCLES + (before) + WAIT_UNTIL_LEAD)
+// cycles from a routine's timer overflow until it returns, for a kernel that outputs its first pixel 'lead' cycles
+// after the wait and 'pixels' pixels 6 cycles apart, 'after' is all it does after the last pixel
+#define LINE_END_CYCLES(lead, pixels, after)	(OUTPUT_DELAY + (lead) + (pixels)*6 + (after) + SCANLINE_EXIT_CYCLES)
+// a routine that returns past SCANLINE_CYCLES delays the next one by the difference, the next one must still
+// be waiting before its output starts
+#define LINE_FITS(end, nextStart)	((end) + (nextStart) <= SCANLINE_CYCLES + OUTPUT_DELAY && (nextStart) <= OUTPUT_DELAY)
+
+#define TITLE_WIDTH					128
+#define TITLE_CHUNK_CYCLES			170	// title stream decoded after each scanline, must end before the next line's output start
+
+#define WIDE_TILES_X				16	// VIDMODE_WIDE reads tmap as rows of 16 tiles
+#define WIDE_TILES_Y				8
+#define WIDE_WIDTH					(WIDE_TILES_X*8)
+
+// linebuf holds two lines of SCREEN_WIDTH+16 (+16 is for sprite clipping) or two titlescreen rows,
+// DEBUG_TILES builds two wide lines with 8 pixels for clipping each
+#ifdef DEBUG_TILES
+#define LINEBUF_SIZE				((WIDE_WIDTH+8)*2)
+#elif SCREEN_WIDTH+16 < TITLE_WIDTH
+#define LINEBUF_SIZE				(TITLE_WIDTH*2)
+#else
+#define LINEBUF_SIZE				((SCREEN_WIDTH+16)*2)
+#endif
+
+#define EVEN_LINE_TILES				8	// tiles copied on the even line of the sprite pipeline, the rest on the odd line
+
+#define HUD_TEXT_TILES				10	// score bar tiles shown as text, the rest are tiles
+#define TEXT_COLOR					0xff
+#define GLYPH_SPACE					0	// blank glyph
+#define GLYPH_DIGITS				35	// glyphs of 0-9
+#define GLYPH_NEWLINE				0xfe	// glyph strings, see tools/textpack.py
+#define GLYPH_END					0xff
 
 #define NUM_SPRITES					3
+#define PLAYER_SPRITE_WIDTH			6	// the last sprite is narrower to fit in the odd scanline
+#define SPRITE_LINES				(SCREEN_HEIGHT-8)	// sprites are clipped at y=8, score bar row has none
+#define SPRITE_TABLE_SIZE			6	// updateSprite calls per tick, sprites sharing a hardware sprite take one each
  
 #define VIDMODE_TILES_AND_SPRITES	0	// 13 tiles wide with 2 sprites per scanline
 #define VIDMODE_INTRO				1	// 14 tiles wide tile only mode
 #define VIDMODE_TITLESCREEN			2	// non-tiled mode
+#define VIDMODE_MESSAGE				3	// tiles and sprites with a text row over the playfield, see showMessage()
+#define VIDMODE_LOWRES				4	// 52 pixels wide tiles with a sprite for each sprite table entry
+#define VIDMODE_WIDE				5	// 16 tiles wide with 3 sprites on 3 scanlines per row, DEBUG_TILES builds only
+
+#define MESSAGE_ROW					5	// tile row covered by the message text
+
+#define MAX_BLANK_TASKS				4
+#define BLANK_TASK_MARGIN			48	// cycles reserved at the end of a blank scanline for interrupt exit
+
+// display list region, regions are stacked from the top of the visible area
+// every region after the first starts with one black scanline on which its setup function is called
+struct DisplayRegion {
+	void		(*setup)(uint8_t row);	// prepares kernel state for the region
+	void		(*routine)();			// scanline routine rendering the region
+	uint8_t		row;					// first tile row shown in the region
+	uint8_t		lines;					// height in scanlines, 0 terminates the list
+};
 
 void initScreen();
 void setVideoMode(uint8_t mode);
-void waitForVBlank();
+void setDisplayList(const DisplayRegion* list, int startLine);	// list in flash, used from the next frame on
+uint8_t waitForVBlank();	// sleeps until vsync, returns vsyncs since the previous call, at once if some were missed
+
+// blank line tasks are run by the video interrupt on the blank lines above and below the display list only,
+// never on region_line or while a region is shown, so they may write tmap and the sprite tables freely
+// a task is started only if its worst case cycle count fits in what is left of the scanline,
+// so tasks must be short and safe to run with interrupts disabled
+bool addBlankTask(void (*func)(), uint16_t cycles);
+void removeBlankTask(void (*func)());
 
 // video interrupt routines
-void blank_line();
-void active_line_titlescreen();
-void active_line_intro();
-void active_line_even();
-void active_line_odd();
-void vsync_line();
-
-// render scanline routines
-void render_titlescreen();
-void render_tiles_14();
-void render_tiles_with_sprites_even();	// even scanlines
-void render_tiles_with_sprites_odd(); 	// odd scanlines
+// the naked timer1 interrupt jumps straight to the current routine, which returns with reti
+// and saves only the registers it uses (render kernels are inlined so their clobbers are known)
+// gcc only accepts signal handlers named __vector*, hence the assembler names
+#define SCANLINE_ROUTINE(name)	void name() __asm__("__vector_" #name) __attribute__((signal, used))
+
+SCANLINE_ROUTINE(blank_line);
+SCANLINE_ROUTINE(region_line);
+SCANLINE_ROUTINE(active_line_titlescreen);
+SCANLINE_ROUTINE(active_line_intro);
+SCANLINE_ROUTINE(active_line_tiles);
+SCANLINE_ROUTINE(active_line_message);
+SCANLINE_ROUTINE(active_line_even);
+SCANLINE_ROUTINE(active_line_odd);
+SCANLINE_ROUTINE(active_line_lowres_even);
+SCANLINE_ROUTINE(active_line_lowres_odd);
+SCANLINE_ROUTINE(active_line_wide_a);
+SCANLINE_ROUTINE(active_line_wide_b);
+SCANLINE_ROUTINE(active_line_wide_c);
+SCANLINE_ROUTINE(vsync_line);
 
 struct SpriteLine {
 	uint8_t*	img;	// sprite image in flash
 	uint8_t		x;
 };
 
+struct Sprite {
+	uint8_t		img;	// tile index in the low 6 bits, hardware sprite in the top 2
+	int8_t		x, y;	// y <= 0 hides the sprite
+};
+
 extern volatile int 		scanLine;
+extern volatile uint8_t		frameCounter;	// vsyncs (audio buffer swaps) since power up, wraps around
+extern void					(*interruptRoutine)();
+extern int					regionEnd;
+
+#ifdef DEBUG_JITTER
+// TCNT1L at scanline interrupt entry, the latency the main loop added is value - JITTER_FIRST
+#define JITTER_FIRST				8		// fastest entry, the main loop ran single cycle instructions
+#define JITTER_BINS					16		// one cycle per bin, the last bin collects everything later
+
+extern uint8_t				isrEntry;							// written by the timer interrupt on every scanline
+extern uint16_t				jitterCounts[JITTER_BINS];			// scanlines of the current frame per bin
+extern uint8_t				jitterCountsMax;					// latest entry of the current frame
+extern volatile uint16_t	jitterHistogram[JITTER_BINS];		// scanlines of the last complete frame per bin
+extern volatile uint8_t		jitterFrameMax;						// latest entry of the last complete frame
+extern volatile uint8_t		jitterMax;							// latest entry since power up
+#endif
 extern volatile uint8_t* 	tmap[NUM_TILES_X*NUM_TILES_Y];	// 234 bytes
 extern volatile uint8_t**	tmapPtr;
 extern volatile uint8_t		tileOffset;
-extern uint8_t				linebuf[(SCREEN_WIDTH+16)*2];
+extern uint8_t				linebuf[LINEBUF_SIZE];
 extern uint8_t*				linebuf1;
 extern uint8_t*				linebuf2;
-extern volatile SpriteLine	spriteBuffer[NUM_SPRITES*SCREEN_HEIGHT+2];
+extern volatile SpriteLine	spriteBuffer[NUM_SPRITES*(SPRITE_LINES+1)];
 extern volatile SpriteLine*	spriteBufferPtr;
+extern volatile SpriteLine	emptySpriteLine[NUM_SPRITES];
 extern PROGMEM prog_uchar tiles[];
+extern PROGMEM prog_uchar font[];
+extern PROGMEM prog_uchar asciiToGlyph[];
+
+// glyph strings in text.h
+extern PROGMEM prog_uchar textIntro1[];
+extern PROGMEM prog_uchar textIntro2[];
+extern PROGMEM prog_uchar textGameOver[];
+extern PROGMEM prog_uchar textYouWin[];
+
+// asm fragments shared by the render kernels
+// fetch tile address from tmap while outputting 3 pixels
+// r19:r18 = tmap, X = src
+#define FETCH_TILE_3_PIXELS \
+		"movw	r30, r18\n\t"		/* restore tmap to Z */ \
+		"ld		r16, Z+\n\t"		/* load tile address to r16, 2c */ \
+		"ld		r0, X+\n\t"			/* read pixel */ \
+		"out	%[port], r0\n\t"	/* output pixel */ \
+		\
+		"ld		r17, Z+\n\t"		/* load tile address to r17, 2c */ \
+		"movw	r18, r30\n\t"		/* r19:r18 = Z, 1c */ \
+		"ld		r0, X+\n\t" \
+		"out	%[port], r0\n\t" \
+		\
+		"movw	r30, r16\n\t"		/* Z = r17:r16, 1c */ \
+		"add	r30, %[tileOffset]\n\t"	/* Z = Z + offset, 1c */ \
+		"adc	r31, r1\n\t"		/* 1c */ \
+		"ld		r0, X+\n\t" \
+		"out	%[port], r0\n\t"
+
+// copy a pixel from flash to sram while outputting 2 pixels
+// Z = tile address, Y = dst, X = src
+#define COPY_PIXEL_2_PIXELS \
+		"lpm	r16, Z+\n\t"		/* load pixel from tile, 3c */ \
+		"ld		r0, X+\n\t"			/* load pixel from buf, 2c */ \
+		"out	%[port], r0\n\t"	/* output pixel, 1c */ \
+		\
+		"st		Y+, r16\n\t"		/* store pixel to buf, 2c */ \
+		"nop\n\t" \
+		"ld		r0, X+\n\t"			/* load pixel from buf, 2c */ \
+		"out	%[port], r0\n\t"	/* output pixel, 1c */
+
+// copy one tile from flash to sram while outputting 19 pixels
+#define COPY_TILE_19_PIXELS \
+		FETCH_TILE_3_PIXELS \
+	".rept 8\n\t" \
+		COPY_PIXEL_2_PIXELS \
+	".endr\n\t"
+
+// DEBUG_JITTER builds count the entry time of every scanline
+inline void countJitter() {
+#ifdef DEBUG_JITTER
+	uint8_t t = isrEntry;
+	if(t > jitterCountsMax)
+		jitterCountsMax = t;
+	uint8_t bin = t - JITTER_FIRST;
+	if(bin >= JITTER_BINS)
+		bin = (t < JITTER_FIRST ? 0 : JITTER_BINS - 1);
+	jitterCounts[bin]++;
+#endif
+}
 
-// call at start of new frame
-inline void prepareTilesWithSprites() {
-	linebuf1 = &linebuf[8];
-	linebuf2 = linebuf1 + SCREEN_WIDTH + 16;
-	tileOffset = 0;
-	spriteBufferPtr = spriteBuffer;
+// called first thing on every scanline, routines that are short of time before their output starts
+// leave out the jitter count and call countJitter() after their kernel
+inline void outputAudioSample(bool jitter = true) {
+	if(jitter)
+		countJitter();
+
+#ifdef ENABLE_SOUND
+	// pull audio from buffer and feed to OCR2A
+	OCR2A = audioBufferReadPtr[scanLine-1];
+#endif
 }
 
+// tile pointers are read by the video interrupt, never let it see a half written pointer
 inline void setTile(uint8_t i, uint8_t tile) {
+	uint8_t sreg = SREG;
+	cli();
 	tmap[i] = &tiles[tile * 64];
+	SREG = sreg;
 }
 
 inline void setTile(uint8_t x, uint8_t y, uint8_t tile) {
-	tmap[y * NUM_TILES_X + x] = &tiles[tile * 64];
+	setTile(y * NUM_TILES_X + x, tile);
+}
+
+// text regions (intro and the text part of the score bar) point tmap to 1bpp glyphs instead of tiles
+inline void setGlyph(uint8_t i, uint8_t glyph) {
+	uint8_t sreg = SREG;
+	cli();
+	tmap[i] = &font[glyph * 8];
+	SREG = sreg;
+}
+
+// glyph for text built at runtime, characters not in the font are blank
+inline uint8_t charToGlyph(uint8_t ch) {
+	ch -= ' ';
+	return ch < 64 ? pgm_read_byte_near(&asciiToGlyph[ch]) : GLYPH_SPACE;
 }
 
 inline uint8_t getTile(uint8_t i) {
@@ -101,16 +295,35 @@ inline uint8_t getTile(uint8_t x, uint8_t y) {
 }
 
 inline uint8_t sampleTile(int8_t x, int8_t y) {
+	// the score bar row holds glyphs, getTile would return garbage for them, so it is empty like the
+	// score bar tiles were to the game before the font
+	if(y < 8)
+		return TILE_EMPTY;
+
 	// clamp sampling point to screen
 	x = constrain(x, 0, SCREEN_WIDTH-1);
-	y = constrain(y, 0, SCREEN_HEIGHT-1);
+	y = min(y, SCREEN_HEIGHT-1);
 	return getTile((uint8_t)x >> 3, (uint8_t)y >> 3);
 }
 
-void clearScreen();
+// display list setup functions
+void prepareTiles(uint8_t row);
+void prepareTilesWithSprites(uint8_t row);
+void prepareLowres(uint8_t row);
+void prepareWide(uint8_t row);
+
+void clearScreen();		// blank glyphs for the text regions
+
+// sprites are built by the game loop into a back table and handed over with presentSprites()
+// the video interrupt picks them up at vsync and expands them to spriteBuffer on blank lines
+// updateSprite adds a sprite to hardware sprite 'sp', sprites that share one show as long as they don't share
+// a line, the one added last wins where they do. VIDMODE_LOWRES shows them all, the first one added on top
+void initSprites();
 void clearSprites();
 void updateSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y);
-void drawText(uint8_t x, uint8_t y, const char* text);
-uint8_t charToTile(uint8_t ch);
+void presentSprites();
+void swapSprites();		// called from vsync_line
+void drawText(uint8_t x, uint8_t y, const prog_uchar* text);	// glyph string, for text regions only
+void showMessage(uint8_t x, const prog_uchar* text);	// glyph string on MESSAGE_ROW, selects VIDMODE_MESSAGE
 
 #endif
@@ -0,0 +1,330 @@
+/*
+ Toorum's Quest II
+ Copyright (c) 2013 Petri Hakkinen
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+*/
+
+// Low resolution render mode with a sprite for every entry of the sprite table
+//
+// Pixels are twice as wide as in the tiles and sprites mode: every other pixel of the tiles and sprites is
+// shown, 52 pixels per scanline 12 cycles apart, so the room and the game's coordinates stay the same.
+// Each pixel leaves 9 free cycles after its output, which is enough to:
+// On even scanlines, copy all tiles of the row to linebuf2, a tile per 4 output pixels, and blit the last sprite
+// of the table after the last pixel.
+// On odd scanlines, blit the other sprites to linebuf2 at a constant 9 output pixels per sprite.
+// Sprites are read straight from the active sprite table, entries are drawn last to first so that the first one
+// added (the player) is on top. Hidden sprites are drawn from the empty tile and write back the background.
+// Like the sprite pipeline, output lags one row of pixels behind, so the region starts with a black row and is
+// two scanlines taller.
+
+#include <arduino.h>
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include "videogen.h"
+
+#define LOWRES_WIDTH			(SCREEN_WIDTH / 2)		// pixels per scanline, 2 of the normal width each
+#define LOWRES_ODD_SPRITES		(SPRITE_TABLE_SIZE - 1)	// the last entry is blitted on the even line
+#define LOWRES_SPRITE_PIXELS	9						// output pixels per sprite blitted on the odd line
+#define LOWRES_ODD_PLAIN_PIXELS	(LOWRES_WIDTH - 1 - LOWRES_ODD_SPRITES*LOWRES_SPRITE_PIXELS)
+
+// cycles spent after the last pixel: output black, the even line loads the sprite operands and blits a sprite
+#define LOWRES_SPRITE_CYCLES	72
+#define LOWRES_EVEN_TAIL_CYCLES	(1 + 9 + LOWRES_SPRITE_CYCLES)
+#define LOWRES_ODD_TAIL_CYCLES	1
+
+// the C code around the kernels, see active_line_lowres_even and active_line_lowres_odd
+#define LOWRES_KERNEL_LEAD		(8 + 3)	// wait to first pixel, gcc may still move the operands to X, Y and Z after the wait
+#define LOWRES_EVEN_BEFORE		14		// loading the kernel's operands
+#define LOWRES_EVEN_AFTER		(16 + JITTER_COUNT_CYCLES)	// next routine, scanLine
+#define LOWRES_ODD_BEFORE		66		// operands, line buffer swap, next tile row, next routine, scanLine, region end
+#define LOWRES_ODD_AFTER		(6 + JITTER_COUNT_CYCLES)	// next pixel row
+
+// a low resolution pixel lasts two normal ones, LINE_END_CYCLES counts in those
+#define LOWRES_EVEN_LINE_END	LINE_END_CYCLES(LOWRES_KERNEL_LEAD, LOWRES_WIDTH*2, LOWRES_EVEN_TAIL_CYCLES + LOWRES_EVEN_AFTER)
+#define LOWRES_ODD_LINE_END		LINE_END_CYCLES(LOWRES_KERNEL_LEAD, LOWRES_WIDTH*2, LOWRES_ODD_TAIL_CYCLES + LOWRES_ODD_AFTER)
+#define LOWRES_EVEN_LINE_START	LINE_START_CYCLES(LOWRES_EVEN_BEFORE)
+#define LOWRES_ODD_LINE_START	LINE_START_CYCLES(LOWRES_ODD_BEFORE)
+
+#if NUM_TILES_X*4 != LOWRES_WIDTH
+#error the even line copies 4 pixels of each tile per 4 output pixels
+#endif
+#if LOWRES_ODD_PLAIN_PIXELS < 0
+#error low resolution sprites do not fit in the odd scanline, decrease SPRITE_TABLE_SIZE
+#endif
+#if SPRITE_TABLE_SIZE != 6
+#error the odd line kernel blits sprite table entries 4-0
+#endif
+#if !LINE_FITS(LOWRES_EVEN_LINE_END, LOWRES_ODD_LINE_START)
+#error low resolution even line does not fit in the scanline
+#endif
+#if !LINE_FITS(LOWRES_ODD_LINE_END, LOWRES_EVEN_LINE_START)
+#error low resolution odd line does not fit in the scanline
+#endif
+
+// read pixel and output it, the 9 cycles until the next output are free
+#define LOWRES_PIXEL \
+		"ld		r0, X+\n\t"			/* read pixel, 2c */ \
+		"out	%[port], r0\n\t"	/* output pixel, 1c */
+
+#define LOWRES_NO_PIXEL	""
+#define LOWRES_NOP		"nop\n\t"
+#define LOWRES_NO_NOP	""
+
+// copy every other pixel of a tile from flash to sram while outputting 4 pixels
+// r19:r18 = tmap, r22 = tile row offset, Y = dst, X = src
+#define LOWRES_COPY_TILE \
+		LOWRES_PIXEL \
+		"movw	r30, r18\n\t"		/* restore tmap to Z, 1c */ \
+		"ld		r16, Z+\n\t"		/* load tile address to r17:r16, 2c */ \
+		"ld		r17, Z+\n\t"		/* 2c */ \
+		"movw	r18, r30\n\t"		/* 1c */ \
+		"movw	r30, r16\n\t"		/* 1c */ \
+		"add	r30, r22\n\t"		/* Z = Z + offset, 1c */ \
+		"adc	r31, r1\n\t"		/* 1c */ \
+		LOWRES_PIXEL \
+		"lpm	r16, Z\n\t"			/* 3c */ \
+		"adiw	r30, 2\n\t"			/* 2c */ \
+		"lpm	r17, Z\n\t"			/* 3c */ \
+		"nop\n\t" \
+		LOWRES_PIXEL \
+		"adiw	r30, 2\n\t"			/* 2c */ \
+		"lpm	r20, Z\n\t"			/* 3c */ \
+		"adiw	r30, 2\n\t"			/* 2c */ \
+		"st		Y+, r16\n\t"		/* 2c */ \
+		LOWRES_PIXEL \
+		"lpm	r21, Z\n\t"			/* 3c */ \
+		"st		Y+, r17\n\t"		/* 2c */ \
+		"st		Y+, r20\n\t"		/* 2c */ \
+		"st		Y+, r21\n\t"		/* 2c */
+
+// blit every other pixel of the row of sprite table entry i, 72 cycles
+// with pixel = LOWRES_PIXEL and pad = LOWRES_NOP the work is spread over 9 output pixels
+// r23:r22 = sprite table, r21 = screen y of the row, r25:r24 = line start - 4 for clipping
+#define LOWRES_SPRITE(i, pixel, pad) \
+		pixel \
+		"movw	r30, r22\n\t"		/* Z = sprite table, 1c */ \
+		"ldd	r16, Z+3*" #i "\n\t"	/* img, 2c */ \
+		"ldd	r17, Z+3*" #i "+1\n\t"	/* x, 2c */ \
+		"ldd	r18, Z+3*" #i "+2\n\t"	/* y, 2c */ \
+		"mov	r19, r21\n\t"		/* 1c */ \
+		"sub	r19, r18\n\t"		/* r19 = row in sprite, 1c */ \
+		pixel \
+		"cpi	r19, 8\n\t"			/* 1c */ \
+		"sbc	r20, r20\n\t"		/* r20 = 0xff if the sprite is on the row, else 0, 1c */ \
+		"andi	r16, 63\n\t"		/* drop the hardware sprite, 1c */ \
+		"ldi	r18, 64\n\t"		/* 1c */ \
+		"mul	r16, r18\n\t"		/* 2c */ \
+		"movw	r30, r0\n\t"		/* Z = img * 64, 1c */ \
+		"clr	r1\n\t"				/* 1c */ \
+		"lsl	r19\n\t"			/* 1c */ \
+		pixel \
+		"lsl	r19\n\t"			/* 1c */ \
+		"lsl	r19\n\t"			/* 1c */ \
+		"add	r30, r19\n\t"		/* Z = Z + row * 8, 1c */ \
+		"and	r30, r20\n\t"		/* hidden sprites read the empty tile, 1c */ \
+		"and	r31, r20\n\t"		/* 1c */ \
+		"subi	r30, lo8(-(tiles))\n\t"	/* 1c */ \
+		"sbci	r31, hi8(-(tiles))\n\t"	/* 1c */ \
+		"subi	r17, -8\n\t"		/* left clip, 1c */ \
+		"lsr	r17\n\t"			/* 1c */ \
+		pixel \
+		"movw	r28, r24\n\t"		/* 1c */ \
+		"add	r28, r17\n\t"		/* 1c */ \
+		"adc	r29, r1\n\t"		/* Y = start of sprite on line, 1c */ \
+		"lpm	r16, Z\n\t"			/* 3c */ \
+		"adiw	r30, 2\n\t"			/* 2c */ \
+		pad \
+		pixel \
+		"ld		r17, Y\n\t"			/* 2c */ \
+		"cpse	r16, r1\n\t"		/* 1c if no skip, 2c if next instr is skipped */ \
+		"mov	r17, r16\n\t"		/* 1c */ \
+		"st		Y+, r17\n\t"		/* 2c */ \
+		"lpm	r16, Z\n\t"			/* 3c */ \
+		pixel \
+		"adiw	r30, 2\n\t"			/* 2c */ \
+		"ld		r17, Y\n\t"			/* 2c */ \
+		"cpse	r16, r1\n\t"		/* 2c with the mov */ \
+		"mov	r17, r16\n\t" \
+		"st		Y+, r17\n\t"		/* 2c */ \
+		pad \
+		pixel \
+		"lpm	r16, Z\n\t"			/* 3c */ \
+		"adiw	r30, 2\n\t"			/* 2c */ \
+		"ld		r17, Y\n\t"			/* 2c */ \
+		"cpse	r16, r1\n\t"		/* 2c with the mov */ \
+		"mov	r17, r16\n\t" \
+		pixel \
+		"st		Y+, r17\n\t"		/* 2c */ \
+		"lpm	r16, Z\n\t"			/* 3c */ \
+		"ld		r17, Y\n\t"			/* 2c */ \
+		"cpse	r16, r1\n\t"		/* 2c with the mov */ \
+		"mov	r17, r16\n\t" \
+		pixel \
+		"st		Y+, r17\n\t"		/* 2c */ \
+		pad pad pad pad pad pad pad
+
+uint8_t		lowresRow;		// screen y of the pixel row being built, read by the kernels
+
+// display list setup for the low resolution mode, starting at tile row 'row'
+void prepareLowres(uint8_t row) {
+	linebuf1 = &linebuf[4];
+	linebuf2 = linebuf1 + LOWRES_WIDTH + 8;
+	tmapPtr = &tmap[row * NUM_TILES_X];
+	tileOffset = 0;
+	lowresRow = row * 8;
+
+	// the first line pair outputs linebuf1 while the pipeline fills
+	for(uint8_t i = 0; i < LOWRES_WIDTH; i++)
+		linebuf1[i] = 0;
+}
+
+static inline void render_lowres_even(uint8_t* src, uint8_t* dst, volatile uint8_t** map) __attribute__((always_inline));
+static inline void render_lowres_odd(uint8_t* src, uint8_t* dst) __attribute__((always_inline));
+
+// like the sprite pipeline, neither line has time for the jitter count before its output starts
+// and the barriers keep gcc from loading or storing globals between the wait and the first pixel
+void active_line_lowres_even() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2;
+	volatile uint8_t** map = tmapPtr;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_lowres_even(src, dst, map);
+
+	interruptRoutine = &active_line_lowres_odd;
+	scanLine++;
+	countJitter();
+}
+
+void active_line_lowres_odd() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2;
+
+	// swap line buffer
+	linebuf1 = dst;
+	linebuf2 = src;
+
+	// advance to next row of pixels in tiles
+	tileOffset = (tileOffset + 8) & (7*8);
+	if(tileOffset == 0)
+		tmapPtr += NUM_TILES_X;		// advance to next row of tiles
+
+	interruptRoutine = &active_line_lowres_even;
+	scanLine++;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_lowres_odd(src, dst);
+
+	lowresRow++;
+	countJitter();
+}
+
+static void render_lowres_even(uint8_t* src, uint8_t* dst, volatile uint8_t** map) {
+	__asm__ __volatile__ (
+		// X = linebuf1 (src)
+		// Y = linebuf2 (dst)
+		// Z = tmap
+
+		"lds	r22, tileOffset\n\t"	// 2c
+		"movw	r18, r30\n\t"		// r19:r18 = tmap
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+
+		// copy the row's tiles from flash to sram while outputting 4 pixels per tile
+	".rept %[numTiles]\n\t"
+		LOWRES_COPY_TILE
+	".endr\n\t"
+
+		"out	%[port],r1\n\t"		// output black
+
+		// blit the last sprite of the table
+		"lds	r22, spriteActivePtr\n\t"	// 2c
+		"lds	r23, spriteActivePtr+1\n\t"	// 2c
+		"lds	r21, lowresRow\n\t"			// 2c
+		"movw	r24, r28\n\t"				// 1c
+		"sbiw	r24, %[width]+4\n\t"		// 2c; rewind to line start - 4
+		LOWRES_SPRITE(%[lastSprite], LOWRES_NO_PIXEL, LOWRES_NO_NOP)
+
+		: "+x" (src), "+y" (dst), "+z" (map)
+		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
+		[numTiles] "n" (NUM_TILES_X),
+		[width] "n" (LOWRES_WIDTH),
+		[lastSprite] "n" (SPRITE_TABLE_SIZE - 1)
+		: "r0", "r16", "r17", "r18", "r19", "r20", "r21", "r22", "r23", "r24", "r25", "memory" // clobbered registers
+	);
+}
+
+static void render_lowres_odd(uint8_t* src, uint8_t* dst) {
+	__asm__ __volatile__ (
+		// X = linebuf1 (src)
+		// Y = linebuf2 (dst)
+
+		"lds	r22, spriteActivePtr\n\t"	// 2c
+		"lds	r23, spriteActivePtr+1\n\t"	// 2c
+		"lds	r21, lowresRow\n\t"			// 2c
+
+		LOWRES_PIXEL
+		"movw	r24, r28\n\t"		// 1c
+		"sbiw	r24, 4\n\t"			// 2c; line start - 4 for clipping
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+
+		// the other sprites, last to first, while outputting 9 pixels each
+		LOWRES_SPRITE(4, LOWRES_PIXEL, LOWRES_NOP)
+		LOWRES_SPRITE(3, LOWRES_PIXEL, LOWRES_NOP)
+		LOWRES_SPRITE(2, LOWRES_PIXEL, LOWRES_NOP)
+		LOWRES_SPRITE(1, LOWRES_PIXEL, LOWRES_NOP)
+		LOWRES_SPRITE(0, LOWRES_PIXEL, LOWRES_NOP)
+
+		// output the remaining pixels
+	".rept %[plainPixels]\n\t"
+		LOWRES_PIXEL
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+	".endr\n\t"
+
+		"out	%[port],r1\n\t"		// output black
+
+		: "+x" (src), "+y" (dst)
+		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
+		[plainPixels] "n" (LOWRES_ODD_PLAIN_PIXELS)
+		: "r0", "r16", "r17", "r18", "r19", "r20", "r21", "r22", "r23", "r24", "r25", "r30", "r31", "memory" // clobbered registers
+	);
+}
@@ -32,58 +32,132 @@
 // Output a pixel every 6th cycle.
 //
 // There is not enough time to do all this on a single scanline, so we split the work across two scanlines:
-// On even scanlines, we write 9 tiles (9*8 pixels) to linebuf2 while outputting pixels from linebuf1 every 6th cycle.  
-// On odd scanlines, we write remaining 4 tiles (4*8 pixels) to linebuf2, process three sprites, and output pixels from linebuf1.
-// Linebuf1 and linebuf2 are then swapped and process repeats for 80*2 scanlines. 
+// On even scanlines, we write EVEN_LINE_TILES tiles (8 by default) to linebuf2 while outputting pixels from linebuf1 every 6th cycle.  
+// On odd scanlines, we write the remaining tiles (5 by default) to linebuf2, process the sprites, and output pixels from linebuf1.
+// Linebuf1 and linebuf2 are then swapped and process repeats for the rest of the display list region.
+// Output lags one row of pixels behind, so the region starts with a black row and is two scanlines taller.
 
 #include <arduino.h>
 #include <avr/interrupt.h>
 #include <avr/io.h>
 #include "videogen.h"
+#include "trace.h"
+
+// The kernels below are generated by the assembler from the screen layout in videogen.h:
+// Even line: tiles are copied while outputting 19 pixels each, the next tile is then fetched in 3 pixels
+// and copied a pixel per 2 output pixels until the line ends. The rest of it and the rest of the even line
+// tiles are copied after the last pixel.
+// Odd line: 1 pixel, 19 pixels per remaining tile and 4 pixels of sprite setup, then plain pixels.
+// The sprites are blitted after the last pixel.
+#define EVEN_FULL_TILES			(SCREEN_WIDTH / 19)
+#define EVEN_REST_PIXELS		(SCREEN_WIDTH - EVEN_FULL_TILES*19)
+#define EVEN_PARTIAL_TILE		(EVEN_REST_PIXELS >= 3 ? 1 : 0)
+#define EVEN_PARTIAL_PIXELS		(EVEN_PARTIAL_TILE ? (EVEN_REST_PIXELS - 3) / 2 : 0)
+#define EVEN_PLAIN_PIXELS		(EVEN_REST_PIXELS - EVEN_PARTIAL_TILE*3 - EVEN_PARTIAL_PIXELS*2)
+#define EVEN_AFTER_TILES		(EVEN_LINE_TILES - EVEN_FULL_TILES - EVEN_PARTIAL_TILE)
+#define ODD_PLAIN_PIXELS		(SCREEN_WIDTH - 5 - (NUM_TILES_X - EVEN_LINE_TILES)*19)
+
+// cycles spent after the last pixel
+#define EVEN_TAIL_CYCLES		((EVEN_PARTIAL_TILE ? (8 - EVEN_PARTIAL_PIXELS)*5 + 2 : 7) + EVEN_AFTER_TILES*46)
+#define ODD_TAIL_CYCLES			((NUM_SPRITES - 1)*(9 + 8*6) + 9 + PLAYER_SPRITE_WIDTH*6 + 4)
+
+// the C code around the kernels, see active_line_even and active_line_odd
+#define SPRITE_KERNEL_LEAD		(8 + 3)	// wait to first pixel, gcc may still move the operands to X, Y and Z after the wait
+#define EVEN_BEFORE_CYCLES		14		// loading the kernel's operands
+#define EVEN_AFTER_CYCLES		(16 + JITTER_COUNT_CYCLES)	// next routine, scanLine
+#define ODD_BEFORE_CYCLES		66		// operands, line buffer swap, next tile row, next routine, scanLine, region end
+#define ODD_AFTER_CYCLES		(13 + JITTER_COUNT_CYCLES)	// score bar row
+
+// the odd line's sprites take it past the end of the scanline, into the wait of the even line
+#define EVEN_LINE_END			LINE_END_CYCLES(SPRITE_KERNEL_LEAD, SCREEN_WIDTH, EVEN_TAIL_CYCLES + EVEN_AFTER_CYCLES)
+#define ODD_LINE_END			LINE_END_CYCLES(SPRITE_KERNEL_LEAD, SCREEN_WIDTH, ODD_TAIL_CYCLES + ODD_AFTER_CYCLES)
+#define EVEN_LINE_START			LINE_START_CYCLES(EVEN_BEFORE_CYCLES)
+#define ODD_LINE_START			LINE_START_CYCLES(ODD_BEFORE_CYCLES)
+
+#if EVEN_LINE_TILES > NUM_TILES_X
+#error EVEN_LINE_TILES is larger than NUM_TILES_X
+#endif
+#if EVEN_AFTER_TILES < 0
+#error EVEN_LINE_TILES is less than the tiles copied while outputting the even line
+#endif
+#if ODD_PLAIN_PIXELS < 0
+#error odd line tiles do not fit in the line, increase EVEN_LINE_TILES
+#endif
+#if !LINE_FITS(EVEN_LINE_END, ODD_LINE_START)
+#error even line tiles do not fit in the scanline, decrease EVEN_LINE_TILES
+#endif
+#if !LINE_FITS(ODD_LINE_END, EVEN_LINE_START)
+#error sprites do not fit in the odd scanline, decrease NUM_SPRITES, PLAYER_SPRITE_WIDTH or NUM_TILES_X
+#endif
+#if NUM_SPRITES < 2 || PLAYER_SPRITE_WIDTH < 1 || PLAYER_SPRITE_WIDTH > 8
+#error the odd line kernel needs at least 2 sprites and a player sprite of 1-8 pixels
+#endif
+#if NUM_SPRITES > 4
+#error the hardware sprite does not fit in the top 2 bits of Sprite::img
+#endif
+#if SCREEN_WIDTH + 8 > 255
+#error screen too wide for the odd line kernel
+#endif
+
+// load the next sprite line after the last pixel
+// X = sprite buffer, r19:r18 = line start address
+#define FETCH_SPRITE \
+		"ld		r30, X+\n\t"		/* 2c */ \
+		"ld		r31, X+\n\t"		/* 2c */ \
+		"ld		r0, X+\n\t"			/* 2c; r0 = spriteX */ \
+		"movw	r28, r18\n\t"		/* 1c; restore line start address */ \
+		"add	r28, r0\n\t"		/* 1c */ \
+		"adc	r29, r1\n\t"		/* 1c; Y = start of sprite on line */
+
+// blit pixel i of a sprite if it is less than the sprite width w, 6 cycles per pixel
+#define BLIT_SPRITE_PIXEL(i, w) \
+	".if " #i " < " w "\n\t" \
+		"lpm	r0, Z+\n\t"			/* 3c */ \
+		"cpse	r0, r1\n\t"		/* 1c if no skip, 2c if next instr is skipped */ \
+		"std	Y+" #i ", r0\n\t"	/* 2c */ \
+	".endif\n\t"
+
+#define BLIT_SPRITE_PIXELS(w) \
+		BLIT_SPRITE_PIXEL(0, w) \
+		BLIT_SPRITE_PIXEL(1, w) \
+		BLIT_SPRITE_PIXEL(2, w) \
+		BLIT_SPRITE_PIXEL(3, w) \
+		BLIT_SPRITE_PIXEL(4, w) \
+		BLIT_SPRITE_PIXEL(5, w) \
+		BLIT_SPRITE_PIXEL(6, w) \
+		BLIT_SPRITE_PIXEL(7, w)
 
 volatile uint8_t* 	tmap[NUM_TILES_X*NUM_TILES_Y];
 volatile uint8_t**	tmapPtr = tmap;
 uint8_t	volatile 	tileOffset;						// tile row offset for scanline (0,8,16,24,32,40,48,56)
-uint8_t				linebuf[(SCREEN_WIDTH+16)*2];	// +16 is for sprite clipping; 240 bytes
+uint8_t				linebuf[LINEBUF_SIZE];	// 256 bytes
 uint8_t*			linebuf1;						// scanline work buffer (src)
 uint8_t*			linebuf2;						// scanline work buffer (dst)
 
-// for each scanline stores:
+// for each scanline of the playfield stores:
 // sprite image ptr, sprite x-coordinate
-volatile SpriteLine		spriteBuffer[NUM_SPRITES*SCREEN_HEIGHT+2];	// 438 bytes	// TODO: why +2?
+// the extra row is never drawn to, it is read on the last line pair which only feeds the unseen row after the region
+volatile SpriteLine		spriteBuffer[NUM_SPRITES*(SPRITE_LINES+1)];	// 657 bytes
 volatile SpriteLine*	spriteBufferPtr = spriteBuffer;
+volatile SpriteLine		emptySpriteLine[NUM_SPRITES];				// fed to the kernel on the score bar row
 
-void clearSprites() {
-	volatile SpriteLine* buf = spriteBuffer;
-	for(uint8_t i = 0; i < NUM_SPRITES*NUM_TILES_Y; i++) {
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-		buf->img = tiles;
-		buf->x = 0;
-		buf++;
-	}
-}
+// sprite tables are triple buffered:
+// the game loop writes one, one waits for vsync after presentSprites() and one is expanded to spriteBuffer
+static Sprite			sprites[3][SPRITE_TABLE_SIZE];
+static Sprite*			spriteWritePtr = sprites[0];
+static Sprite*			spritePendingPtr = sprites[1];
+Sprite*					spriteActivePtr = sprites[2];	// also read by the low resolution kernels
+static volatile bool	spritesPresented = false;
+static uint8_t			spriteWriteCount;	// sprites added to the write table since clearSprites
 
-void updateSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y) {
+// expansion progress: lines 0..SPRITE_LINES-1 are being cleared, then sprites are drawn one by one
+#define EXPAND_CLEAR_LINES		8
+#define EXPAND_DONE				(SPRITE_LINES + SPRITE_TABLE_SIZE)
+#define EXPAND_SPRITES_CYCLES	320
+
+static uint8_t			expandPos;
+
+static void drawSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y) {
 	// cull sprite
 	if(x <= -8 || x >= SCREEN_WIDTH) {
 		img = 0;
@@ -118,13 +192,14 @@ void updateSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y) {
 	// bottom clip
 	h = min(h, SCREEN_HEIGHT - y);
 
-	// hw sprite 3 (player) is only 6 pixels wide, adjust coordinates so that first pixel of sprite data is skipped
-	if(sp == 2) {
-		x++;
-		p++;
+	// last hw sprite (player) is only PLAYER_SPRITE_WIDTH pixels wide, adjust coordinates so that the
+	// sprite data is centered
+	if(sp == NUM_SPRITES-1) {
+		x += (8 - PLAYER_SPRITE_WIDTH)/2;
+		p += (8 - PLAYER_SPRITE_WIDTH)/2;
 	}
 
-	volatile SpriteLine* buf = &spriteBuffer[((uint8_t)y)*NUM_SPRITES + sp];
+	volatile SpriteLine* buf = &spriteBuffer[((uint8_t)y - 8)*NUM_SPRITES + sp];
 	for(uint8_t i = 0; i < h; i++) {
 		buf->img = p;
 		buf->x = x;
@@ -133,109 +208,211 @@ void updateSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y) {
 	}
 }
 
-void render_tiles_with_sprites_even() {
-	__asm__ __volatile__ (
-		// X = linebuf1 (src)
-		// Y = linebuf2 (dst)
-		// Z = tmap
-		// [tileOffset] = tile row offset (0,8,16,24,32,40,48,56)
+// blank line task, expands the active sprite table to spriteBuffer in small steps
+static void expandSprites() {
+	uint8_t pos = expandPos;
+	TRACE_ISR_BEGIN(TRACE_SPRITE_EXPAND);
+	if(pos < SPRITE_LINES) {
+		volatile SpriteLine* buf = &spriteBuffer[pos * NUM_SPRITES];
+		for(uint8_t i = 0; i < EXPAND_CLEAR_LINES*NUM_SPRITES; i++) {
+			buf->img = tiles;
+			buf->x = 0;
+			buf++;
+		}
+		expandPos = pos + EXPAND_CLEAR_LINES;
+	} else if(pos < EXPAND_DONE) {
+		Sprite* s = &spriteActivePtr[pos - SPRITE_LINES];
+		drawSprite(s->img >> 6, s->img & 63, s->x, s->y);
+		expandPos = pos + 1;
+	}
+	TRACE_ISR_END(TRACE_SPRITE_EXPAND);
+}
 
-		"movw	r18, r30\n\t"		// r19:r18 = tmap
+void initSprites() {
+	for(uint8_t i = 0; i < NUM_SPRITES; i++) {
+		emptySpriteLine[i].img = tiles;
+		emptySpriteLine[i].x = 0;
+		spriteBuffer[NUM_SPRITES*SPRITE_LINES + i].img = tiles;
+		spriteBuffer[NUM_SPRITES*SPRITE_LINES + i].x = 0;
+	}
 
-		"nop\n\t"
-		"nop\n\t"
+	// all sprite tables start out hidden, clear spriteBuffer on the first blank lines
+	expandPos = 0;
+	addBlankTask(expandSprites, EXPAND_SPRITES_CYCLES);
+}
 
-		// copy first 5 tiles from flash to sram
-		// output pixels every 6th cycle
+void clearSprites() {
+	for(uint8_t i = 0; i < SPRITE_TABLE_SIZE; i++) {
+		spriteWritePtr[i].img = 0;
+		spriteWritePtr[i].y = 0;
+	}
+	spriteWriteCount = 0;
+}
 
-	".rept 5\n\t"
-		// fetch tile address from tmap, output 3 pixels
-		"movw	r30, r18\n\t"		// restore tmap to Z
-		"ld		r16, Z+\n\t"		// load tile address to r16, 2c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
+void updateSprite(uint8_t sp, uint8_t img, int8_t x, int8_t y) {
+	if(spriteWriteCount == SPRITE_TABLE_SIZE)
+		return;
+	// culled sprites are hidden at x=0, the low resolution kernels blit every sprite and need it on the line
+	if(x <= -8 || x >= SCREEN_WIDTH) {
+		x = 0;
+		y = 0;
+	}
 
-		"ld		r17, Z+\n\t"		// load tile address to r17, 2c
-		"movw	r18, r30\n\t"		// r:19:r18 = Z, 1c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
+	Sprite* s = &spriteWritePtr[spriteWriteCount++];
+	s->img = img | (sp << 6);
+	s->x = x;
+	s->y = y;
+}
 
-		"movw	r30, r16\n\t"		// Z = r17:r16, 1c
-		"add	r30, %[tileOffset]\n\t"	// Z = Z + offset, 1c
-		"adc	r31, r1\n\t"		// 1c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
+void presentSprites() {
+	uint8_t sreg = SREG;
+	cli();
+	Sprite* tmp = spritePendingPtr;
+	spritePendingPtr = spriteWritePtr;
+	spriteWritePtr = tmp;
+	spritesPresented = true;
+	SREG = sreg;
+}
+
+void swapSprites() {
+	if(spritesPresented) {
+		Sprite* tmp = spriteActivePtr;
+		spriteActivePtr = spritePendingPtr;
+		spritePendingPtr = tmp;
+		spritesPresented = false;
+		expandPos = 0;
+	}
+}
+
+// display list setup for the tile and sprite pipeline, starting at tile row 'row'
+void prepareTilesWithSprites(uint8_t row) {
+	linebuf1 = &linebuf[8];
+	linebuf2 = linebuf1 + SCREEN_WIDTH + 16;
+	tmapPtr = &tmap[row * NUM_TILES_X];
+	tileOffset = 0;
+
+	// score bar row has no sprites, active_line_odd moves on to spriteBuffer after it
+	spriteBufferPtr = (row == 0 ? emptySpriteLine : &spriteBuffer[(row - 1) * 8 * NUM_SPRITES]);
+
+	// the first line pair outputs linebuf1 while the pipeline fills
+	for(uint8_t i = 0; i < SCREEN_WIDTH; i++)
+		linebuf1[i] = 0;
+}
+
+// kernels are inlined into the scanline routines so that gcc saves exactly the registers they use
+static inline void render_tiles_with_sprites_even(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset)
+	__attribute__((always_inline));
+static inline void render_tiles_with_sprites_odd(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset)
+	__attribute__((always_inline));
+
+// the even line has time left after its last pixel, the odd line has none and does its bookkeeping first
+// pipeline regions have an even number of lines, so only the odd line can end one
+// neither has time for the jitter count before its output starts
+// the barriers keep gcc from loading or storing globals between the wait and the first pixel
+void active_line_even() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2;
+	volatile uint8_t** map = tmapPtr;
+	uint8_t offset = tileOffset;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_tiles_with_sprites_even(src, dst, map, offset);
+
+	interruptRoutine = &active_line_odd;
+	scanLine++;
+	countJitter();
+}
+
+void active_line_odd() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2;
+	volatile uint8_t** map = tmapPtr;
+	uint8_t offset = tileOffset;
+
+	// swap line buffer
+	linebuf1 = dst;
+	linebuf2 = src;
+
+	// advance to next row of pixels in tiles
+	tileOffset = (offset + 8) & (7*8);
+	if(tileOffset == 0)
+		tmapPtr = map + NUM_TILES_X;	// advance to next row of tiles
+
+	interruptRoutine = &active_line_even;
+	scanLine++;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_tiles_with_sprites_odd(src, dst, map, offset);
 
-		// copy 8 pixels from flash to buf, output 16 pixels
+	// score bar row has no sprites, keep rereading the empty sprite line until the first playfield row
+	if(map == tmap)
+		spriteBufferPtr = (offset == 7*8 ? spriteBuffer : emptySpriteLine);
+	countJitter();
+}
+
+static void render_tiles_with_sprites_even(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset) {
+	__asm__ __volatile__ (
 		// X = linebuf1 (src)
 		// Y = linebuf2 (dst)
-		// Z = tile address
-		// 6*8 = 48 cycles
-	".rept 8\n\t"
-		"lpm	r16, Z+\n\t"		// load pixel from tile, 3c
-		"ld		r0, X+\n\t"			// load pixel from buf, 2c
-		"out	%[port], r0\n\t"	// output pixel, 1c
+		// Z = tmap
+		// [tileOffset] = tile row offset (0,8,16,24,32,40,48,56)
+
+		"movw	r18, r30\n\t"		// r19:r18 = tmap
 
-		"st		Y+, r16\n\t"		// store pixel to buf, 2c
 		"nop\n\t"
-		"ld		r0, X+\n\t"			// load pixel from buf, 2c
-		"out	%[port], r0\n\t"	// output pixel, 1c
-	".endr\n\t"
+		"nop\n\t"
 
+		// copy first tiles from flash to sram while outputting 19 pixels per tile
+	".rept %[fullTiles]\n\t"
+		COPY_TILE_19_PIXELS
 	".endr\n\t"
 
-		// 95 pixels outputted at this point
-		// output remaining 9 pixels for total 104 pixels
-
-		// fetch tile address from tmap, output 3 pixels
-		"movw	r30, r18\n\t"		// restore tmap to Z
-		"ld		r16, Z+\n\t"		// load tile address to r16, 2c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
-
-		"ld		r17, Z+\n\t"		// load tile address to r17, 2c
-		"movw	r18, r30\n\t"		// r:19:r18 = Z, 1c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
+		// output the remaining pixels, copying as much of the next tile as fits
+	".if %[partialTile]\n\t"
+		FETCH_TILE_3_PIXELS
+	".rept %[partialPixels]\n\t"
+		COPY_PIXEL_2_PIXELS
+	".endr\n\t"
+	".endif\n\t"
 
-		"movw	r30, r16\n\t"		// Z = r17:r16, 1c
-		"add	r30, %[tileOffset]\n\t"	// Z = Z + offset, 1c
-		"adc	r31, r1\n\t"		// 1c
+	".rept %[plainPixels]\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
 		"ld		r0, X+\n\t"			// read pixel
 		"out	%[port], r0\n\t"	// output pixel
+	".endr\n\t"
 
-		// output 6 pixels and copy 3 pixels
-".rept 3\n\t"
-		"lpm	r16, Z+\n\t"		// load pixel from tile, 3c
-		"ld		r0, X+\n\t"			// load pixel from buf, 2c
-		"out	%[port], r0\n\t"	// output pixel, 1c
-
-		"st		Y+, r16\n\t"		// store pixel to buf, 2c
-		"nop\n\t"
-		"ld		r0, X+\n\t"			// load pixel from buf, 2c
-		"out	%[port], r0\n\t"	// output pixel, 1c
-".endr\n\t"
-
-		// copy remaining 5 pixels for the sixth tile
+		// all pixels have been outputted, copy the rest of the partial tile
+	".if %[partialTile]\n\t"
 		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
 		"st		Y+, r0\n\t"			// store pixel to buf, 2c
 		"out	%[port],r1\n\t"		// output black
+	".rept 8-1-%[partialPixels]\n\t"
 		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
 		"st		Y+, r0\n\t"			// store pixel to buf, 2c
-		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
-		"st		Y+, r0\n\t"			// store pixel to buf, 2c
-		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
-		"st		Y+, r0\n\t"			// store pixel to buf, 2c
-		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
-		"st		Y+, r0\n\t"			// store pixel to buf, 2c
-
-		// all 104 pixels have been outputted
-		// 6 tiles (48 pixels) have been copied
+	".endr\n\t"
+	".else\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"out	%[port],r1\n\t"		// output black
+	".endif\n\t"
 
 		"movw	r26, r18\n\t"		// restore tmap to X
-		// copy three more tiles (no time for more)
+		// copy the rest of the even line tiles (no time for more)
 		// 6 + 8 * 5 = 46 cycles per tile
-	".rept 3\n\t"
+	".rept %[afterTiles]\n\t"
 		"ld		r30, X+\n\t"		// load tile address to ZL, 2c
 		"ld		r31, X+\n\t"		// load tile address to ZH, 2c
 		"add	r30, %[tileOffset]\n\t"	// Z = Z + offset, 1c
@@ -246,82 +423,48 @@ void render_tiles_with_sprites_even() {
 	".endr\n\t"
 	".endr\n\t"
 
-		// total 9 tiles copied, 104 pixels outputted
-
-		:
+		: "+x" (src), "+y" (dst), "+z" (map)
 		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
-		"x" (linebuf1),
-		"y" (linebuf2),
-		"z" (tmapPtr),
-		[tileOffset] "r" (tileOffset)
+		[tileOffset] "r" (offset),
+		[fullTiles] "n" (EVEN_FULL_TILES),
+		[partialTile] "n" (EVEN_PARTIAL_TILE),
+		[partialPixels] "n" (EVEN_PARTIAL_PIXELS),
+		[plainPixels] "n" (EVEN_PLAIN_PIXELS),
+		[afterTiles] "n" (EVEN_AFTER_TILES)
 		: "r0", "r16", "r17", "r18", "r19" // clobbered registers
 	);
 }
 
-void render_tiles_with_sprites_odd() {
+static void render_tiles_with_sprites_odd(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset) {
 	__asm__ __volatile__ (
 		// X = linebuf1 (src)
 		// Y = linebuf2 (dst)
 		// Z = tmap
 		// [tileOffset] = tile row offset (0,8,16,24,32,40,48,56)
 
-		// skip 9 tiles (72 pixels) that we're already copied in render_tiles_with_sprites_even
-		// increment Y 72 pixels
-		"ldi	r16, 72\n\t"
-		"add	r28, r16\n\t"		// Y = Y + 72
+		// skip the tiles that were already copied in render_tiles_with_sprites_even
+		// increment Y by their pixels
+		"ldi	r16, %[evenTiles]*8\n\t"
+		"add	r28, r16\n\t"		// Y = Y + even tiles * 8
 		"adc	r29, r1\n\t"
 
-		// offset tmap pointer by 9 tiles (18 bytes)
-		"adiw	r30, 18\n\t"		// 2c
+		// offset tmap pointer by the even tiles (2 bytes each)
+		"adiw	r30, %[evenTiles]*2\n\t"	// 2c
 		"movw	r18, r30\n\t"		// r19:r18 = tmap
 		"ld		r0, X+\n\t"			// read pixel
 		"out	%[port], r0\n\t"	// output pixel
 
-		// copy 4 tiles from flash to sram
-		// output pixels every 6th cycle
-
-	".rept 4\n\t"
-		// fetch tile address from tmap, output 3 pixels
-		"movw	r30, r18\n\t"		// restore tmap to Z
-		"ld		r16, Z+\n\t"		// load tile address to r16, 2c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
-
-		"ld		r17, Z+\n\t"		// load tile address to r17, 2c
-		"movw	r18, r30\n\t"		// r:19:r18 = Z, 1c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
-
-		"movw	r30, r16\n\t"		// Z = r17:r16, 1c
-		"add	r30, %[tileOffset]\n\t"	// Z = Z + offset, 1c
-		"adc	r31, r1\n\t"		// 1c
-		"ld		r0, X+\n\t"			// read pixel
-		"out	%[port], r0\n\t"	// output pixel
-
-		// copy 8 pixels from flash to buf, output 16 pixels
-		// X = linebuf1 (src)
-		// Y = linebuf2 (dst)
-		// Z = tile address
-		// 6*8 = 48 cycles
-	".rept 8\n\t"
-		"lpm	r16, Z+\n\t"		// load pixel from tile, 3c
-		"ld		r0, X+\n\t"			// load pixel from buf, 2c
-		"out	%[port], r0\n\t"	// output pixel, 1c
-
-		"st		Y+, r16\n\t"		// store pixel to buf, 2c
-		"nop\n\t"
-		"ld		r0, X+\n\t"			// load pixel from buf, 2c
-		"out	%[port], r0\n\t"	// output pixel, 1c
-	".endr\n\t"
-
+		// copy the odd line tiles from flash to sram while outputting 19 pixels per tile
+	".rept %[oddTiles]\n\t"
+		COPY_TILE_19_PIXELS
 	".endr\n\t"
 
-		// all tiles have been copied, 77 pixels have been outputted, 27 pixels remaining
+		// all tiles have been copied
 
 		// TODO: interleave first sprite setup with video output
 
 		// rewind Y back to start of line and output 1 pixel
-		"ldi	r18, 104+8\n\t"		// +8 for sprite clipping
+		"ldi	r18, %[width]+8\n\t"	// +8 for sprite clipping
 		"sub	r28, r18\n\t"
 		"sbc	r29, r1\n\t"
 		"ld		r0, X+\n\t"			// read pixel
@@ -345,9 +488,9 @@ void render_tiles_with_sprites_odd() {
 		"ld		r0, Z+\n\t"			// read pixel
 		"out	%[port], r0\n\t"	// output pixel
 
-		// output 23 pixels
-	".rept 23\n\t"
-		"nop\n\t"	// cycles free: 3*23 = 69
+		// output the remaining pixels
+	".rept %[oddPixels]\n\t"
+		"nop\n\t"
 		"nop\n\t"
 		"nop\n\t"
 		"ld		r0, Z+\n\t"			// read pixel
@@ -373,109 +516,19 @@ void render_tiles_with_sprites_odd() {
 		"add	r28, r0\n\t"				// 1c;
 		"adc	r29, r1\n\t"				// 1c; Y = start of sprite on line
 
-		// do 8 sprite pixels (6 cycles per pixel)
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+0, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+1, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+2, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+3, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+4, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+5, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+6, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+7, r0\n\t"				// 2c
-
-		// === SPRITE 2 ===
-
-		// load sprite image address to Z
-		// load sprite x-coordinate to r0 
-		"ld		r30, X+\n\t"				// 2c
-		"ld		r31, X+\n\t"				// 2c
-		"ld		r0, X+\n\t"					// 2c; r0 = spriteX
+		BLIT_SPRITE_PIXELS("8")
 
-		// load dest address to Y
-		"movw	r28, r18\n\t"				// 1c; restore line start address
-		"add	r28, r0\n\t"				// 1c;
-		"adc	r29, r1\n\t"				// 1c; Y = start of sprite on line
-
-		// do 8 sprite pixels (6 cycles per pixel)
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+0, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+1, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+2, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+3, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+4, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+5, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+6, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+7, r0\n\t"				// 2c
-
-		/// === SPRITE 3 ===
-
-		// load sprite image address to Z
-		// load sprite x-coordinate to r0 
-		"ld		r30, X+\n\t"				// 2c
-		"ld		r31, X+\n\t"				// 2c
-		"ld		r0, X+\n\t"					// 2c; r0 = spriteX
+		// === SPRITES 2 .. NUM_SPRITES-1 ===
+	".rept %[numSprites]-2\n\t"
+		FETCH_SPRITE
+		BLIT_SPRITE_PIXELS("8")
+	".endr\n\t"
 
-		// load dest address to Y
-		"movw	r28, r18\n\t"				// 1c; restore line start address
-		"add	r28, r0\n\t"				// 1c;
-		"adc	r29, r1\n\t"				// 1c; Y = start of sprite on line
+		// === LAST SPRITE ===
 
-		// sprite 3 (player) is only 6 pixels wide!
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+0, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+1, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+2, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+3, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+4, r0\n\t"				// 2c
-		"lpm	r0, Z+\n\t"					// 3c
-		"cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		"std	Y+5, r0\n\t"				// 2c
-		// "lpm	r0, Z+\n\t"					// 3c
-		// "cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		// "std	Y+6, r0\n\t"				// 2c
-		// "lpm	r0, Z+\n\t"					// 3c
-		// "cpse	r0, r1\n\t"					// 1c if no skip, 2c if next instr is skipped
-		// "std	Y+7, r0\n\t"				// 2c
+		// last sprite (player) is only PLAYER_SPRITE_WIDTH pixels wide!
+		FETCH_SPRITE
+		BLIT_SPRITE_PIXELS("%[playerWidth]")
 
 		// sprites done!
 
@@ -483,12 +536,15 @@ void render_tiles_with_sprites_odd() {
 		"sts	spriteBufferPtr, r26\n\t"	// 2c
 		"sts	spriteBufferPtr+1, r27\n\t"	// 2c
 
-		:
+		: "+x" (src), "+y" (dst), "+z" (map)
 		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
-		"x" (linebuf1),
-		"y" (linebuf2),
-		"z" (tmapPtr),
-		[tileOffset] "r" (tileOffset)
-		: "r0", "r16", "r17", "r18", "r19" // clobbered registers
+		[tileOffset] "r" (offset),
+		[evenTiles] "n" (EVEN_LINE_TILES),
+		[oddTiles] "n" (NUM_TILES_X - EVEN_LINE_TILES),
+		[oddPixels] "n" (ODD_PLAIN_PIXELS),
+		[width] "n" (SCREEN_WIDTH),
+		[numSprites] "n" (NUM_SPRITES),
+		[playerWidth] "n" (PLAYER_SPRITE_WIDTH)
+		: "r0", "r16", "r17", "r18", "r19", "memory" // clobbered registers
 	);
 }
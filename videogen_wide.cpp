@@ -0,0 +1,393 @@
+/*
+ Toorum's Quest II
+ Copyright (c) 2013 Petri Hakkinen
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in
+ all copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ THE SOFTWARE.
+*/
+
+// Render mode with 16 tiles wide rows and sprites
+//
+// The sprite pipeline's two scanlines have no time for more than 13 tiles. Here each row of pixels is output
+// on three scanlines, which leaves time for WIDE_TILES_X tiles (128 pixels) per row:
+// Line A copies tiles 0-6 to linebuf2 like the sprite pipeline's even line, the rest of the last one after its
+// last pixel.
+// Line B does the same for tiles 7-13.
+// Line C copies tiles 14-15 and blits the sprites from spriteBuffer while outputting, then swaps the line
+// buffers and moves on to the next row of pixels in the output's spare pixels.
+// tmap is read as WIDE_TILES_Y rows of WIDE_TILES_X tiles. Sprites keep the coordinates and the culling of the
+// other modes, so they only show on the first SCREEN_WIDTH pixels.
+// Output lags one row of pixels behind, so the region starts with a black row and is three scanlines taller.
+//
+// The mode is only built with DEBUG_TILES, the longer line buffers take 16 more bytes of ram.
+
+#include <arduino.h>
+#include <avr/interrupt.h>
+#include <avr/io.h>
+#include "videogen.h"
+
+// lines A and B: full tiles while outputting 19 pixels each, the next tile is then fetched in 3 pixels and copied
+// a pixel per 2 output pixels until the line ends. The rest of it is copied after the last pixel.
+// line C: the last tiles, then 3 pixels of sprite setup, 4 pixels per sprite fetch and 2 pixels per sprite pixel,
+// 2 pixels to store the sprite buffer and 15 pixels of row bookkeeping
+#define WIDE_FULL_TILES			(WIDE_WIDTH / 19)
+#define WIDE_REST_PIXELS		(WIDE_WIDTH - WIDE_FULL_TILES*19)
+#define WIDE_PARTIAL_PIXELS		((WIDE_REST_PIXELS - 3) / 2)
+#define WIDE_PLAIN_PIXELS		(WIDE_REST_PIXELS - 3 - WIDE_PARTIAL_PIXELS*2)
+#define WIDE_LINE_TILES			(WIDE_FULL_TILES + 1)	// tiles copied on lines A and B
+#define WIDE_LAST_TILES			(WIDE_TILES_X - WIDE_LINE_TILES*2)
+#define WIDE_SPRITE_PIXELS		((NUM_SPRITES - 1)*(4 + 8*2) + 4 + PLAYER_SPRITE_WIDTH*2)
+#define WIDE_LAST_PLAIN_PIXELS	(WIDE_WIDTH - WIDE_LAST_TILES*19 - 3 - WIDE_SPRITE_PIXELS - 2 - 15)
+
+// cycles spent after the last pixel
+#define WIDE_TILES_TAIL_CYCLES	((8 - WIDE_PARTIAL_PIXELS)*5 + 2)
+#define WIDE_LAST_TAIL_CYCLES	1
+
+// the C code around the kernels, see active_line_wide_a, active_line_wide_b and active_line_wide_c
+#define WIDE_KERNEL_LEAD		(8 + 3)	// wait to first pixel, gcc may still move the operands to X, Y and Z after the wait
+#define WIDE_A_BEFORE_CYCLES	14		// loading the kernel's operands
+#define WIDE_B_BEFORE_CYCLES	20		// loading the kernel's operands and moving them to the line's first tile
+#define WIDE_C_BEFORE_CYCLES	20
+#define WIDE_AFTER_CYCLES		(16 + JITTER_COUNT_CYCLES)	// next routine, scanLine
+#define WIDE_C_AFTER_CYCLES		(42 + JITTER_COUNT_CYCLES)	// next routine, scanLine, region end, first row
+
+#define WIDE_TILES_LINE_END		LINE_END_CYCLES(WIDE_KERNEL_LEAD, WIDE_WIDTH, WIDE_TILES_TAIL_CYCLES + WIDE_AFTER_CYCLES)
+#define WIDE_LAST_LINE_END		LINE_END_CYCLES(WIDE_KERNEL_LEAD, WIDE_WIDTH, WIDE_LAST_TAIL_CYCLES + WIDE_C_AFTER_CYCLES)
+#define WIDE_A_LINE_START		LINE_START_CYCLES(WIDE_A_BEFORE_CYCLES)
+#define WIDE_B_LINE_START		LINE_START_CYCLES(WIDE_B_BEFORE_CYCLES)
+#define WIDE_C_LINE_START		LINE_START_CYCLES(WIDE_C_BEFORE_CYCLES)
+
+#if WIDE_TILES_X*WIDE_TILES_Y > NUM_TILES_X*NUM_TILES_Y
+#error wide rows do not fit in tmap
+#endif
+#if WIDE_REST_PIXELS < 3
+#error lines A and B need 3 pixels after their full tiles to fetch the next one
+#endif
+#if WIDE_LAST_TILES < 0 || WIDE_LAST_PLAIN_PIXELS < 0
+#error tiles and sprites do not fit in line C, decrease WIDE_TILES_X or NUM_SPRITES
+#endif
+#if !LINE_FITS(WIDE_TILES_LINE_END, WIDE_B_LINE_START)
+#error wide line A does not fit in the scanline
+#endif
+#if !LINE_FITS(WIDE_TILES_LINE_END, WIDE_C_LINE_START)
+#error wide line B does not fit in the scanline
+#endif
+#if !LINE_FITS(WIDE_LAST_LINE_END, WIDE_A_LINE_START)
+#error wide line C does not fit in the scanline
+#endif
+
+#ifdef DEBUG_TILES
+
+// read pixel and output it, after 3 cycles of other work
+#define WIDE_PIXEL \
+		"ld		r0, X+\n\t"			/* read pixel, 2c */ \
+		"out	%[port], r0\n\t"	/* output pixel, 1c */
+
+// load the next sprite line while outputting 4 pixels
+// r25:r24 = sprite buffer, r23:r22 = line start address
+#define WIDE_FETCH_SPRITE \
+		"movw	r28, r24\n\t"		/* Y = sprite buffer, 1c */ \
+		"ld		r30, Y+\n\t"		/* 2c */ \
+		WIDE_PIXEL \
+		"ld		r31, Y+\n\t"		/* 2c */ \
+		"nop\n\t" \
+		WIDE_PIXEL \
+		"ld		r20, Y+\n\t"		/* 2c; r20 = spriteX */ \
+		"movw	r24, r28\n\t"		/* 1c */ \
+		WIDE_PIXEL \
+		"movw	r28, r22\n\t"		/* 1c; restore line start address */ \
+		"add	r28, r20\n\t"		/* 1c */ \
+		"adc	r29, r1\n\t"		/* 1c; Y = start of sprite on line */ \
+		WIDE_PIXEL
+
+// blit pixel i of a sprite if it is less than the sprite width w while outputting 2 pixels
+#define WIDE_BLIT_PIXEL(i, w) \
+	".if " #i " < " w "\n\t" \
+		"lpm	r16, Z+\n\t"		/* 3c */ \
+		WIDE_PIXEL \
+		"cpse	r16, r1\n\t"		/* 1c if no skip, 2c if next instr is skipped */ \
+		"std	Y+" #i ", r16\n\t"	/* 2c */ \
+		WIDE_PIXEL \
+	".endif\n\t"
+
+#define WIDE_BLIT_PIXELS(w) \
+		WIDE_BLIT_PIXEL(0, w) \
+		WIDE_BLIT_PIXEL(1, w) \
+		WIDE_BLIT_PIXEL(2, w) \
+		WIDE_BLIT_PIXEL(3, w) \
+		WIDE_BLIT_PIXEL(4, w) \
+		WIDE_BLIT_PIXEL(5, w) \
+		WIDE_BLIT_PIXEL(6, w) \
+		WIDE_BLIT_PIXEL(7, w)
+
+// display list setup for the wide mode, starting at tile row 'row'
+void prepareWide(uint8_t row) {
+	linebuf1 = &linebuf[8];
+	linebuf2 = linebuf1 + WIDE_WIDTH + 8;
+	tmapPtr = &tmap[row * WIDE_TILES_X];
+	tileOffset = 0;
+
+	// like prepareTilesWithSprites, the first tile row has no sprites
+	spriteBufferPtr = (row == 0 ? emptySpriteLine : &spriteBuffer[(row - 1) * 8 * NUM_SPRITES]);
+
+	// the first three lines output linebuf1 while the pipeline fills
+	for(uint8_t i = 0; i < WIDE_WIDTH; i++)
+		linebuf1[i] = 0;
+}
+
+static inline void render_wide_tiles(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset)
+	__attribute__((always_inline));
+static inline void render_wide_last(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset)
+	__attribute__((always_inline));
+
+// none of the lines has time for the jitter count before its output starts
+// the barriers keep gcc from loading or storing globals between the wait and the first pixel
+void active_line_wide_a() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2;
+	volatile uint8_t** map = tmapPtr;
+	uint8_t offset = tileOffset;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_wide_tiles(src, dst, map, offset);
+
+	interruptRoutine = &active_line_wide_b;
+	scanLine++;
+	countJitter();
+}
+
+void active_line_wide_b() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2 + WIDE_LINE_TILES*8;
+	volatile uint8_t** map = tmapPtr + WIDE_LINE_TILES;
+	uint8_t offset = tileOffset;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_wide_tiles(src, dst, map, offset);
+
+	interruptRoutine = &active_line_wide_c;
+	scanLine++;
+	countJitter();
+}
+
+// wide regions are a multiple of three lines high, only line C can end one
+void active_line_wide_c() {
+	outputAudioSample(false);
+
+	uint8_t* src = linebuf1;
+	uint8_t* dst = linebuf2 + WIDE_LINE_TILES*2*8;
+	volatile uint8_t** row = tmapPtr;
+	volatile uint8_t** map = row + WIDE_LINE_TILES*2;
+	uint8_t offset = tileOffset;
+
+	__asm__ __volatile__ ("" ::: "memory");
+	wait_until(OUTPUT_DELAY);
+	render_wide_last(src, dst, map, offset);
+
+	// the kernel has swapped the line buffers and advanced tileOffset and tmapPtr
+	interruptRoutine = &active_line_wide_a;
+	scanLine++;
+	if(scanLine == regionEnd)
+		interruptRoutine = &region_line;
+
+	// first tile row has no sprites, keep rereading the empty sprite line until the second one
+	if(row == tmap)
+		spriteBufferPtr = (offset == 7*8 ? spriteBuffer : emptySpriteLine);
+	countJitter();
+}
+
+static void render_wide_tiles(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset) {
+	__asm__ __volatile__ (
+		// X = linebuf1 (src)
+		// Y = linebuf2 at the line's first tile (dst)
+		// Z = tmap at the line's first tile
+		// [tileOffset] = tile row offset (0,8,16,24,32,40,48,56)
+
+		"movw	r18, r30\n\t"		// r19:r18 = tmap
+
+		"nop\n\t"
+		"nop\n\t"
+
+		// copy the full tiles from flash to sram while outputting 19 pixels per tile
+	".rept %[fullTiles]\n\t"
+		COPY_TILE_19_PIXELS
+	".endr\n\t"
+
+		// output the remaining pixels, copying as much of the last tile as fits
+		FETCH_TILE_3_PIXELS
+	".rept %[partialPixels]\n\t"
+		COPY_PIXEL_2_PIXELS
+	".endr\n\t"
+
+	".rept %[plainPixels]\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"ld		r0, X+\n\t"			// read pixel
+		"out	%[port], r0\n\t"	// output pixel
+	".endr\n\t"
+
+		// all pixels have been outputted, copy the rest of the last tile
+		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
+		"st		Y+, r0\n\t"			// store pixel to buf, 2c
+		"out	%[port],r1\n\t"		// output black
+	".rept 8-1-%[partialPixels]\n\t"
+		"lpm	r0, Z+\n\t"			// load pixel from tile, 3c
+		"st		Y+, r0\n\t"			// store pixel to buf, 2c
+	".endr\n\t"
+
+		: "+x" (src), "+y" (dst), "+z" (map)
+		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
+		[tileOffset] "r" (offset),
+		[fullTiles] "n" (WIDE_FULL_TILES),
+		[partialPixels] "n" (WIDE_PARTIAL_PIXELS),
+		[plainPixels] "n" (WIDE_PLAIN_PIXELS)
+		: "r0", "r16", "r17", "r18", "r19" // clobbered registers
+	);
+}
+
+static void render_wide_last(uint8_t* src, uint8_t* dst, volatile uint8_t** map, uint8_t offset) {
+	__asm__ __volatile__ (
+		// X = linebuf1 (src)
+		// Y = linebuf2 at the line's first tile (dst)
+		// Z = tmap at the line's first tile
+		// [tileOffset] = tile row offset (0,8,16,24,32,40,48,56)
+
+		"movw	r18, r30\n\t"		// r19:r18 = tmap
+
+		"nop\n\t"
+		"nop\n\t"
+
+		// copy the last tiles from flash to sram while outputting 19 pixels per tile
+	".rept %[lastTiles]\n\t"
+		COPY_TILE_19_PIXELS
+	".endr\n\t"
+
+		// sprite setup
+		"lds	r24, spriteBufferPtr\n\t"	// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"lds	r25, spriteBufferPtr+1\n\t"	// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"movw	r22, r28\n\t"				// 1c
+		"subi	r22, lo8(%[width]+8)\n\t"	// 1c; rewind to line start - 8 for sprite clipping
+		"sbci	r23, hi8(%[width]+8)\n\t"	// 1c
+		WIDE_PIXEL
+
+		// sprites, the last one (player) is only PLAYER_SPRITE_WIDTH pixels wide
+	".rept %[numSprites]-1\n\t"
+		WIDE_FETCH_SPRITE
+		WIDE_BLIT_PIXELS("8")
+	".endr\n\t"
+		WIDE_FETCH_SPRITE
+		WIDE_BLIT_PIXELS("%[playerWidth]")
+
+		// store sprite buffer address
+		"sts	spriteBufferPtr, r24\n\t"	// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"sts	spriteBufferPtr+1, r25\n\t"	// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+
+		// advance to next row of pixels in tiles, and to the next row of tiles after the last one
+		"lds	r16, tileOffset\n\t"		// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"subi	r16, -8\n\t"				// 1c
+		"andi	r16, 7*8\n\t"				// 1c
+		"cpi	r16, 1\n\t"					// 1c; carry = next row of tiles
+		WIDE_PIXEL
+		"sts	tileOffset, r16\n\t"		// 2c
+		"sbc	r20, r20\n\t"				// 1c
+		WIDE_PIXEL
+		"andi	r20, %[rowBytes]\n\t"		// 1c; r20 = a row of tmap or 0
+		"lds	r16, tmapPtr\n\t"			// 2c
+		WIDE_PIXEL
+		"lds	r17, tmapPtr+1\n\t"			// 2c
+		"add	r16, r20\n\t"				// 1c
+		WIDE_PIXEL
+		"adc	r17, r1\n\t"				// 1c
+		"sts	tmapPtr, r16\n\t"			// 2c
+		WIDE_PIXEL
+		"sts	tmapPtr+1, r17\n\t"			// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+
+		// swap line buffers
+		"lds	r16, linebuf1\n\t"			// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"lds	r17, linebuf1+1\n\t"		// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"lds	r18, linebuf2\n\t"			// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"lds	r19, linebuf2+1\n\t"		// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"sts	linebuf1, r18\n\t"			// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"sts	linebuf1+1, r19\n\t"		// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"sts	linebuf2, r16\n\t"			// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+		"sts	linebuf2+1, r17\n\t"		// 2c
+		"nop\n\t"
+		WIDE_PIXEL
+
+		// output the remaining pixels
+	".rept %[plainPixels]\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		WIDE_PIXEL
+	".endr\n\t"
+
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"nop\n\t"
+		"out	%[port],r1\n\t"		// output black
+
+		: "+x" (src), "+y" (dst), "+z" (map)
+		: [port] "i" (_SFR_IO_ADDR(PORT_VID)),
+		[tileOffset] "r" (offset),
+		[lastTiles] "n" (WIDE_LAST_TILES),
+		[width] "n" (WIDE_WIDTH),
+		[numSprites] "n" (NUM_SPRITES),
+		[playerWidth] "n" (PLAYER_SPRITE_WIDTH),
+		[rowBytes] "n" (WIDE_TILES_X*2),
+		[plainPixels] "n" (WIDE_LAST_PLAIN_PIXELS)
+		: "r0", "r16", "r17", "r18", "r19", "r20", "r22", "r23", "r24", "r25", "memory" // clobbered registers
+	);
+}
+
+#endif